@@ -0,0 +1,27 @@
+{
+  'targets': [
+    {
+      'target_name': 'ki_bench',
+      'include_dirs': [ '<!@(node -p "require(\'..\').include_dir")' ],
+      'cflags_cc': [ '-std=c++17', '-O3' ],
+      'xcode_settings': {
+        'OTHER_CFLAGS': [ '-std=c++17' ],
+        'GCC_OPTIMIZATION_LEVEL': '3',
+      },
+      'msvs_settings': {
+        'VCCLCompilerTool': {
+          'AdditionalOptions': [ '/std:c++17' ],
+        },
+      },
+      'defines': [
+        'NAPI_VERSION=9',
+      ],
+      'sources': [
+        'main.cc',
+        'dispatch_bench.cc',
+        'prototype_bench.cc',
+        'types_bench.cc',
+      ],
+    }
+  ]
+}
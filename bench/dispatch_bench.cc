@@ -0,0 +1,210 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#include <kizunapi.h>
+
+#include <cassert>
+
+namespace {
+
+// The same functions are exported via raw N-API and via kizunapi.
+int Arity0() {
+  return 0;
+}
+
+int Arity1(int a) {
+  return a;
+}
+
+int Arity4(int a, int b, int c, int d) {
+  return a + b + c + d;
+}
+
+int Arity8(int a, int b, int c, int d, int e, int f, int g, int h) {
+  return a + b + c + d + e + f + g + h;
+}
+
+class Receiver {
+ public:
+  int Arity0() { return ::Arity0(); }
+  int Arity1(int a) { return ::Arity1(a); }
+  int Arity4(int a, int b, int c, int d) { return ::Arity4(a, b, c, d); }
+  int Arity8(int a, int b, int c, int d, int e, int f, int g, int h) {
+    return ::Arity8(a, b, c, d, e, f, g, h);
+  }
+};
+
+// Free functions taking the receiver as first argument, for MemberFunction.
+template<typename... ArgTypes>
+struct ReceiverFunction {
+  template<int (Receiver::*method)(ArgTypes...)>
+  static int Call(Receiver* receiver, ArgTypes... args) {
+    return (receiver->*method)(args...);
+  }
+};
+
+// Hand-written napi_callback for |func|, the baseline of the benchmark.
+template<typename Sig, Sig func>
+struct RawBinding;
+
+template<typename... ArgTypes, int (*func)(ArgTypes...)>
+struct RawBinding<int(*)(ArgTypes...), func> {
+  static constexpr size_t kArity = sizeof...(ArgTypes);
+
+  static napi_value Call(napi_env env, napi_callback_info info) {
+    size_t argc = kArity;
+    napi_value argv[kArity > 0 ? kArity : 1];
+    if (napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr) != napi_ok)
+      return nullptr;
+    return Dispatch(env, argc, argv, std::index_sequence_for<ArgTypes...>());
+  }
+
+ private:
+  template<size_t... indices>
+  static napi_value Dispatch(napi_env env, size_t argc, napi_value* argv,
+                             std::index_sequence<indices...>) {
+    int32_t args[kArity > 0 ? kArity : 1] = {};
+    if (argc < kArity) {
+      napi_throw_type_error(env, nullptr, "Insufficient number of arguments.");
+      return nullptr;
+    }
+    for (size_t i = 0; i < kArity; ++i) {
+      if (napi_get_value_int32(env, argv[i], &args[i]) != napi_ok) {
+        napi_throw_type_error(env, nullptr, "Integer expected.");
+        return nullptr;
+      }
+    }
+    napi_value result;
+    napi_create_int32(env, func(args[indices]...), &result);
+    return result;
+  }
+};
+
+// Hand-written napi_callback for |method|, unwraps |this| before the call.
+template<typename Sig, Sig method>
+struct RawMethodBinding;
+
+template<typename... ArgTypes, int (Receiver::*method)(ArgTypes...)>
+struct RawMethodBinding<int (Receiver::*)(ArgTypes...), method> {
+  static constexpr size_t kArity = sizeof...(ArgTypes);
+
+  static napi_value Call(napi_env env, napi_callback_info info) {
+    size_t argc = kArity;
+    napi_value argv[kArity > 0 ? kArity : 1];
+    napi_value self;
+    if (napi_get_cb_info(env, info, &argc, argv, &self, nullptr) != napi_ok)
+      return nullptr;
+    void* receiver;
+    if (napi_unwrap(env, self, &receiver) != napi_ok) {
+      napi_throw_type_error(env, nullptr, "Receiver expected.");
+      return nullptr;
+    }
+    // The wrappers of kizunapi store WrapData instead of the native pointer.
+    receiver = static_cast<ki::internal::WrapData*>(receiver)->data;
+    return Dispatch(env, static_cast<Receiver*>(receiver), argc, argv,
+                    std::index_sequence_for<ArgTypes...>());
+  }
+
+ private:
+  template<size_t... indices>
+  static napi_value Dispatch(napi_env env, Receiver* receiver,
+                             size_t argc, napi_value* argv,
+                             std::index_sequence<indices...>) {
+    int32_t args[kArity > 0 ? kArity : 1] = {};
+    if (argc < kArity) {
+      napi_throw_type_error(env, nullptr, "Insufficient number of arguments.");
+      return nullptr;
+    }
+    for (size_t i = 0; i < kArity; ++i) {
+      if (napi_get_value_int32(env, argv[i], &args[i]) != napi_ok) {
+        napi_throw_type_error(env, nullptr, "Integer expected.");
+        return nullptr;
+      }
+    }
+    napi_value result;
+    napi_create_int32(env, (receiver->*method)(args[indices]...), &result);
+    return result;
+  }
+};
+
+napi_value CreateRawFunction(napi_env env, napi_callback callback) {
+  napi_value result;
+  napi_status s = napi_create_function(env, nullptr, 0, callback, nullptr,
+                                       &result);
+  assert(s == napi_ok);
+  return result;
+}
+
+#define RAW_FUNCTION(func) \
+    CreateRawFunction(env, &RawBinding<decltype(&func), &func>::Call)
+#define RAW_METHOD(method) \
+    CreateRawFunction(env, &RawMethodBinding<decltype(&method), &method>::Call)
+
+}  // namespace
+
+namespace ki {
+
+template<>
+struct Type<Receiver> {
+  static constexpr const char* name = "Receiver";
+  static Receiver* Constructor() {
+    return new Receiver;
+  }
+  static void Destructor(Receiver* ptr) {
+    delete ptr;
+  }
+  static void Define(napi_env env, napi_value, napi_value prototype) {
+    Set(env, prototype,
+        "arity0", &Receiver::Arity0,
+        "arity1", &Receiver::Arity1,
+        "arity4", &Receiver::Arity4,
+        "arity8", &Receiver::Arity8,
+        "fnArity0", Fn<&Receiver::Arity0>(),
+        "fnArity1", Fn<&Receiver::Arity1>(),
+        "fnArity4", Fn<&Receiver::Arity4>(),
+        "fnArity8", Fn<&Receiver::Arity8>(),
+        "rawArity0", RAW_METHOD(Receiver::Arity0),
+        "rawArity1", RAW_METHOD(Receiver::Arity1),
+        "rawArity4", RAW_METHOD(Receiver::Arity4),
+        "rawArity8", RAW_METHOD(Receiver::Arity8));
+  }
+};
+
+}  // namespace ki
+
+void run_dispatch_bench(napi_env env, napi_value binding) {
+  napi_value raw = ki::CreateObject(env);
+  ki::Set(env, raw,
+          "arity0", RAW_FUNCTION(Arity0),
+          "arity1", RAW_FUNCTION(Arity1),
+          "arity4", RAW_FUNCTION(Arity4),
+          "arity8", RAW_FUNCTION(Arity8));
+  napi_value function = ki::CreateObject(env);
+  ki::Set(env, function,
+          "arity0", &Arity0,
+          "arity1", &Arity1,
+          "arity4", &Arity4,
+          "arity8", &Arity8);
+  napi_value fn = ki::CreateObject(env);
+  ki::Set(env, fn,
+          "arity0", ki::Fn<&Arity0>(),
+          "arity1", ki::Fn<&Arity1>(),
+          "arity4", ki::Fn<&Arity4>(),
+          "arity8", ki::Fn<&Arity8>());
+  using R0 = ReceiverFunction<>;
+  using R1 = ReceiverFunction<int>;
+  using R4 = ReceiverFunction<int, int, int, int>;
+  using R8 = ReceiverFunction<int, int, int, int, int, int, int, int>;
+  napi_value member_function = ki::CreateObject(env);
+  ki::Set(env, member_function,
+          "arity0", ki::MemberFunction(&R0::Call<&Receiver::Arity0>),
+          "arity1", ki::MemberFunction(&R1::Call<&Receiver::Arity1>),
+          "arity4", ki::MemberFunction(&R4::Call<&Receiver::Arity4>),
+          "arity8", ki::MemberFunction(&R8::Call<&Receiver::Arity8>));
+  ki::Set(env, binding,
+          "raw", raw,
+          "function", function,
+          "fn", fn,
+          "memberFunction", member_function,
+          "Receiver", ki::Class<Receiver>());
+}
@@ -0,0 +1,36 @@
+// Call |func| with |arity| arguments on |self| in a loop.
+const loops = {
+  0: (self, func) => (n) => { for (let i = 0; i < n; ++i) func.call(self) },
+  1: (self, func) => (n) => { for (let i = 0; i < n; ++i) func.call(self, 1) },
+  4: (self, func) => (n) => {
+    for (let i = 0; i < n; ++i) func.call(self, 1, 2, 3, 4)
+  },
+  8: (self, func) => (n) => {
+    for (let i = 0; i < n; ++i) func.call(self, 1, 2, 3, 4, 5, 6, 7, 8)
+  },
+}
+
+exports.runBenchmarks = (binding, {measure}) => {
+  const {raw, function: func, fn, memberFunction, Receiver} = binding
+  const receiver = new Receiver
+  for (const arity in loops) {
+    const loop = loops[arity]
+    const name = `arity${arity}`
+    const rawName = `rawArity${arity}`
+    const fnName = `fnArity${arity}`
+    measure(`arity ${arity}: raw napi_create_function`,
+            loop(null, raw[name]))
+    measure(`arity ${arity}: ki function`,
+            loop(null, func[name]))
+    measure(`arity ${arity}: ki::Fn function`,
+            loop(null, fn[name]))
+    measure(`arity ${arity}: raw method (napi_unwrap)`,
+            loop(receiver, Receiver.prototype[rawName]))
+    measure(`arity ${arity}: ki::MemberFunction`,
+            loop(receiver, memberFunction[name]))
+    measure(`arity ${arity}: ki prototype method`,
+            loop(receiver, Receiver.prototype[name]))
+    measure(`arity ${arity}: ki::Fn prototype method`,
+            loop(receiver, Receiver.prototype[fnName]))
+  }
+}
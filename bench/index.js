@@ -0,0 +1,59 @@
+const fs = require('fs')
+const path = require('path')
+
+const bindings = require('./build/Release/ki_bench')
+
+// Each benchmark runs for at least |minTime| nanoseconds per sample, and the
+// fastest of |samples| runs is reported.
+const minTime = 100n * 1000n * 1000n
+const samples = 5
+
+main()
+
+function main() {
+  // Optional filter: node bench/index.js [pattern]
+  const filter = process.argv[2] ? new RegExp(process.argv[2]) : null
+  const measure = (name, run) => {
+    if (filter && !filter.test(name))
+      return
+    report(name, benchmark(run))
+  }
+  for (const f of fs.readdirSync(__dirname)) {
+    if (!f.endsWith('_bench.js'))
+      continue
+    const bench = path.basename(f, '_bench.js')
+    console.log(`# ${bench}`)
+    require(path.join(__dirname, f)).runBenchmarks(bindings[bench], {measure})
+  }
+}
+
+// Run |run(iterations)| and return the best nanoseconds per iteration.
+function benchmark(run) {
+  // Warm up and find an iteration count that takes long enough to measure.
+  let iterations = 1
+  while (true) {
+    const elapsed = time(run, iterations)
+    if (elapsed >= minTime)
+      break
+    if (elapsed <= 0n)
+      iterations *= 16
+    else
+      iterations = Math.ceil(iterations * Number(minTime) / Number(elapsed) * 1.1)
+  }
+  let best = Infinity
+  for (let i = 0; i < samples; ++i)
+    best = Math.min(best, Number(time(run, iterations)) / iterations)
+  return best
+}
+
+function time(run, iterations) {
+  const start = process.hrtime.bigint()
+  run(iterations)
+  return process.hrtime.bigint() - start
+}
+
+function report(name, nsPerOp) {
+  const opsPerSec = Math.round(1e9 / nsPerOp).toLocaleString('en-US')
+  console.log(`${name.padEnd(52)} ${opsPerSec.padStart(16)} ops/sec ` +
+              `${nsPerOp.toFixed(2).padStart(12)} ns/op`)
+}
@@ -0,0 +1,21 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#include <kizunapi.h>
+
+#define BENCH(Name) \
+  {  \
+    void run_##Name##_bench(napi_env env, napi_value exports); \
+    napi_value binding = ki::CreateObject(env); \
+    ki::Set(env, exports, #Name, binding); \
+    run_##Name##_bench(env, binding); \
+  }
+
+napi_value Init(napi_env env, napi_value exports) {
+  BENCH(dispatch);
+  BENCH(prototype);
+  BENCH(types);
+  return exports;
+}
+
+NAPI_MODULE(NODE_GYP_MODULE_NAME, Init);
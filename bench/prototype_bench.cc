@@ -0,0 +1,137 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#include <kizunapi.h>
+
+#include <algorithm>
+
+namespace {
+
+// Release handles every |kBatchSize| iterations.
+constexpr uint32_t kBatchSize = 1024;
+
+template<typename F>
+void RunLoop(napi_env env, uint32_t iterations, const F& body) {
+  for (uint32_t i = 0; i < iterations; i += kBatchSize) {
+    ki::HandleScope handle_scope(env);
+    uint32_t end = std::min(iterations, i + kBatchSize);
+    for (uint32_t j = i; j < end; ++j) {
+      if (!body(j)) {
+        ki::ThrowError(env, "Conversion failed.");
+        return;
+      }
+    }
+  }
+}
+
+class Widget {
+ public:
+  int Value() const { return 8964; }
+
+  int width = 8964;
+};
+
+constexpr char kWidth[] = "width";
+
+// Native objects that have JS wrappers, which are kept alive by JS.
+std::vector<Widget*> g_pool;
+
+std::vector<Widget*> CreatePool(uint32_t size) {
+  g_pool.clear();
+  for (uint32_t i = 0; i < size; ++i)
+    g_pool.push_back(new Widget);
+  return g_pool;
+}
+
+// Return the wrappers of the pooled objects to JS, which only does lookups.
+void ToNodePool(napi_env env, uint32_t iterations) {
+  RunLoop(env, iterations, [&](uint32_t i) {
+    napi_value result;
+    return ki::ConvertToNode(env, g_pool[i % g_pool.size()], &result) ==
+           napi_ok;
+  });
+}
+
+// Return new objects to JS, which creates and stores wrappers.
+void ToNodeNew(napi_env env, uint32_t iterations) {
+  RunLoop(env, iterations, [&](uint32_t) {
+    napi_value result;
+    return ki::ConvertToNode(env, new Widget, &result) == napi_ok;
+  });
+}
+
+// Return the constructor to JS, which only looks up the cached constructor.
+void ClassToNode(napi_env env, uint32_t iterations) {
+  RunLoop(env, iterations, [&](uint32_t) {
+    napi_value result;
+    return ki::ConvertToNode(env, ki::Class<Widget>(), &result) == napi_ok;
+  });
+}
+
+void FromNode(napi_env env, napi_value value, uint32_t iterations) {
+  RunLoop(env, iterations, [&](uint32_t) {
+    return ki::FromNodeTo<Widget*>(env, value).has_value();
+  });
+}
+
+// The Widget* alternative is tried before the value is converted to vector.
+void VariantFromNode(napi_env env, napi_value value, uint32_t iterations) {
+  RunLoop(env, iterations, [&](uint32_t) {
+    return ki::FromNodeTo<std::variant<Widget*, std::vector<int>>>(
+        env, value).has_value();
+  });
+}
+
+// Look up the attached table of |object| and read a key of it.
+void AttachedTableGet(napi_env env, napi_value object, uint32_t iterations) {
+  ki::AttachedTable(env, object).Set("width", 8964);
+  RunLoop(env, iterations, [&](uint32_t) {
+    int width;
+    return ki::AttachedTable(env, object).Get("width", &width);
+  });
+}
+
+}  // namespace
+
+namespace ki {
+
+template<>
+struct Type<Widget> {
+  static constexpr const char* name = "Widget";
+  static Widget* Constructor() {
+    return new Widget;
+  }
+  static void Define(napi_env env, napi_value, napi_value prototype) {
+    Set(env, prototype, "value", &Widget::Value);
+    DefineProperties(env, prototype,
+                     Property("propertyWidth", &Widget::width),
+                     Property("cachedWidth", &Widget::width,
+                              Property::CacheMode::Getter));
+    DefineProperties(env, prototype,
+                     Properties<Prop<kWidth, &Widget::width>>());
+  }
+};
+
+template<>
+struct TypeBridge<Widget> {
+  static Widget* Wrap(Widget* ptr) {
+    return ptr;
+  }
+  static void Finalize(Widget* ptr) {
+    delete ptr;
+  }
+};
+
+}  // namespace ki
+
+void run_prototype_bench(napi_env env, napi_value binding) {
+  ki::Set(env, binding,
+          "Widget", ki::Class<Widget>(),
+          "createPool", &CreatePool,
+          "toNodePool", &ToNodePool,
+          "toNodeNew", &ToNodeNew,
+          "classToNode", &ClassToNode,
+          "fromNode", &FromNode,
+          "variantFromNode", &VariantFromNode,
+          "attachedTableGet", &AttachedTableGet);
+}
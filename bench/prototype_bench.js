@@ -0,0 +1,35 @@
+exports.runBenchmarks = (binding, {measure}) => {
+  const {Widget, createPool, toNodePool, toNodeNew, classToNode,
+         fromNode, variantFromNode, attachedTableGet} = binding
+  const widget = new Widget
+  measure('new Widget', (n) => { for (let i = 0; i < n; ++i) new Widget })
+  // Separate loops so each property access site stays monomorphic.
+  measure('get ki::Property', (n) => {
+    for (let i = 0; i < n; ++i) widget.propertyWidth
+  })
+  measure('set ki::Property', (n) => {
+    for (let i = 0; i < n; ++i) widget.propertyWidth = i
+  })
+  measure('get ki::Property (cached)', (n) => {
+    for (let i = 0; i < n; ++i) widget.cachedWidth
+  })
+  measure('get ki::Prop', (n) => {
+    for (let i = 0; i < n; ++i) widget.width
+  })
+  measure('set ki::Prop', (n) => {
+    for (let i = 0; i < n; ++i) widget.width = i
+  })
+  measure('ToNode ki::Class<Widget>', (n) => classToNode(n))
+  measure('FromNode Widget*', (n) => fromNode(widget, n))
+  const array = [8, 9, 6, 4]
+  measure('FromNode std::variant<Widget*, std::vector<int>>',
+          (n) => variantFromNode(array, n))
+  measure('AttachedTable Get', (n) => attachedTableGet(widget, n))
+  measure('ToNode Widget* (new wrapper)', (n) => toNodeNew(n))
+  for (const size of [1, 100000]) {
+    // Keep the wrappers alive so the conversions only do lookups.
+    const pool = createPool(size)
+    measure(`ToNode Widget* (${size} live wrappers)`, (n) => toNodePool(n))
+    pool.length = 0
+  }
+}
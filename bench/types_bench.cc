@@ -0,0 +1,294 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#include <kizunapi.h>
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+
+namespace {
+
+// Conversions create handles, release them every |kBatchSize| iterations so
+// the handle scope does not grow with the iteration count.
+constexpr uint32_t kBatchSize = 1024;
+
+// Run |body| for |iterations| times, stop when it fails.
+template<typename F>
+void RunLoop(napi_env env, uint32_t iterations, const char* error,
+             const F& body) {
+  for (uint32_t i = 0; i < iterations; i += kBatchSize) {
+    ki::HandleScope handle_scope(env);
+    uint32_t end = std::min(iterations, i + kBatchSize);
+    for (uint32_t j = i; j < end; ++j) {
+      if (!body()) {
+        ki::ThrowError(env, error);
+        return;
+      }
+    }
+  }
+}
+
+template<typename T>
+void ToNodeLoop(napi_env env, const T& value, uint32_t iterations) {
+  RunLoop(env, iterations, "ToNode failed.", [&]() {
+    napi_value result;
+    return ki::ConvertToNode(env, value, &result) == napi_ok;
+  });
+}
+
+template<typename T>
+void FromNodeLoop(napi_env env, napi_value value, uint32_t iterations) {
+  RunLoop(env, iterations, "FromNode failed.", [&]() {
+    return ki::FromNodeTo<T>(env, value).has_value();
+  });
+}
+
+// Export {sample, toNode(iterations), fromNode(value, iterations)} for T.
+template<typename T>
+void AddBenchmark(napi_env env, napi_value binding, const char* name,
+                  T sample) {
+  napi_value bench = ki::CreateObject(env);
+  std::function<void(napi_env, uint32_t)> to_node =
+      [sample](napi_env env, uint32_t iterations) {
+        ToNodeLoop(env, sample, iterations);
+      };
+  ki::Set(env, bench,
+          "sample", sample,
+          "toNode", to_node,
+          "fromNode", &FromNodeLoop<T>);
+  ki::Set(env, binding, name, bench);
+}
+
+// Export {sample, fromNode(value, iterations)} for T that only has FromNode.
+template<typename T>
+void AddFromNodeBenchmark(napi_env env, napi_value binding, const char* name,
+                          napi_value sample) {
+  napi_value bench = ki::CreateObject(env);
+  ki::Set(env, bench,
+          "sample", sample,
+          "fromNode", &FromNodeLoop<T>);
+  ki::Set(env, binding, name, bench);
+}
+
+// Export {toNode(iterations)} for T that consumes the converted value, each
+// conversion creates T from a copy of |source|.
+template<typename T, typename Source>
+void AddMoveToNodeBenchmark(napi_env env, napi_value binding, const char* name,
+                            Source source) {
+  napi_value bench = ki::CreateObject(env);
+  std::function<void(napi_env, uint32_t)> to_node =
+      [source](napi_env env, uint32_t iterations) {
+        RunLoop(env, iterations, "ToNode failed.", [&]() {
+          napi_value result;
+          return ki::ConvertToNode(env, T(Source(source)), &result) == napi_ok;
+        });
+      };
+  ki::Set(env, bench, "toNode", to_node);
+  ki::Set(env, binding, name, bench);
+}
+
+// Export {toNode(iterations)} for T that only has ToNode.
+template<typename T>
+void AddToNodeBenchmark(napi_env env, napi_value binding, const char* name,
+                        T sample) {
+  napi_value bench = ki::CreateObject(env);
+  std::function<void(napi_env, uint32_t)> to_node =
+      [sample](napi_env env, uint32_t iterations) {
+        ToNodeLoop(env, sample, iterations);
+      };
+  ki::Set(env, bench, "toNode", to_node);
+  ki::Set(env, binding, name, bench);
+}
+
+// Export {sample, get(object, iterations)} that reads |key| of the sample.
+template<typename K>
+void AddGetBenchmark(napi_env env, napi_value binding, const char* name,
+                     K key) {
+  napi_value bench = ki::CreateObject(env);
+  napi_value sample = ki::CreateObject(env);
+  ki::Set(env, sample, key, 8964);
+  std::function<void(napi_env, napi_value, uint32_t)> get =
+      [key](napi_env env, napi_value object, uint32_t iterations) {
+        RunLoop(env, iterations, "Get failed.", [&]() {
+          int value;
+          return ki::Get(env, object, key, &value);
+        });
+      };
+  ki::Set(env, bench, "sample", sample, "get", get);
+  ki::Set(env, binding, name, bench);
+}
+
+constexpr char kWidth[] = "width";
+
+napi_value CreateFloat64Array(napi_env env, size_t length) {
+  napi_value buffer, result;
+  void* data;
+  napi_create_arraybuffer(env, length * sizeof(double), &data, &buffer);
+  napi_create_typedarray(env, napi_float64_array, length, buffer, 0, &result);
+  return result;
+}
+
+template<typename T>
+std::vector<T> MakeVector(size_t size, T (*generate)(size_t)) {
+  std::vector<T> result;
+  for (size_t i = 0; i < size; ++i)
+    result.push_back(generate(i));
+  return result;
+}
+
+int IntAt(size_t i) { return static_cast<int>(i); }
+double DoubleAt(size_t i) { return i * 0.5; }
+std::string StringAt(size_t i) { return "item" + std::to_string(i); }
+
+// A tree of about 100k nodes.
+using Record = std::map<std::string, std::variant<double, std::string>>;
+
+std::vector<Record> MakeRecords() {
+  std::vector<Record> records(5000);
+  for (size_t i = 0; i < records.size(); ++i) {
+    for (size_t j = 0; j < 10; ++j) {
+      if (j % 2 == 0)
+        records[i][StringAt(j)] = DoubleAt(i + j);
+      else
+        records[i][StringAt(j)] = StringAt(i + j);
+    }
+  }
+  return records;
+}
+
+// Same struct converted by ki::Fields and by hand with ki::Set/ki::Get.
+struct Rect {
+  int x = 0;
+  int y = 0;
+  double width = 0;
+  double height = 0;
+};
+
+struct ManualRect : Rect {};
+
+constexpr char kX[] = "x";
+constexpr char kY[] = "y";
+constexpr char kHeight[] = "height";
+
+}  // namespace
+
+namespace ki {
+
+template<>
+struct Type<Rect> : Fields<Field<kX, &Rect::x>,
+                           Field<kY, &Rect::y>,
+                           Field<kWidth, &Rect::width>,
+                           Field<kHeight, &Rect::height>> {
+  static constexpr const char* name = "Rect";
+};
+
+template<>
+struct Type<ManualRect> {
+  static constexpr const char* name = "Rect";
+  static napi_status ToNode(napi_env env, const ManualRect& value,
+                            napi_value* result) {
+    napi_status s = napi_create_object(env, result);
+    if (s != napi_ok)
+      return s;
+    if (!Set(env, *result, "x", value.x, "y", value.y,
+             "width", value.width, "height", value.height)) {
+      return napi_generic_failure;
+    }
+    return napi_ok;
+  }
+  static std::optional<ManualRect> FromNode(napi_env env, napi_value value) {
+    ManualRect out;
+    if (Get(env, value, "x", &out.x, "y", &out.y,
+            "width", &out.width, "height", &out.height)) {
+      return out;
+    }
+    return std::nullopt;
+  }
+};
+
+}  // namespace ki
+
+void run_types_bench(napi_env env, napi_value binding) {
+  AddBenchmark<int8_t>(env, binding, "int8_t", -89);
+  AddBenchmark<uint8_t>(env, binding, "uint8_t", 64);
+  AddBenchmark<int16_t>(env, binding, "int16_t", -8964);
+  AddBenchmark<uint16_t>(env, binding, "uint16_t", 8964);
+  AddBenchmark<int32_t>(env, binding, "int32_t", -8964);
+  AddBenchmark<uint32_t>(env, binding, "uint32_t", 8964);
+  AddBenchmark<int64_t>(env, binding, "int64_t", 19890604);
+  AddBenchmark<uint64_t>(env, binding, "uint64_t", 19890604);
+  AddBenchmark<float>(env, binding, "float", 3.14f);
+  AddBenchmark<double>(env, binding, "double", 3.14);
+  AddBenchmark<bool>(env, binding, "bool", true);
+  // size_t has its own converter only on macOS, it is uint64_t elsewhere.
+  AddBenchmark<size_t>(env, binding, "size_t", 19890604);
+  AddToNodeBenchmark<const char*>(env, binding, "const char*(8)", "kizunapi");
+  AddToNodeBenchmark<const char16_t*>(env, binding, "const char16_t*(8)",
+                                      u"kizunapi");
+  AddToNodeBenchmark<std::nullptr_t>(env, binding, "std::nullptr_t", nullptr);
+  AddBenchmark(env, binding, "std::monostate", std::monostate());
+  AddBenchmark<std::string>(env, binding, "std::string(8)", "kizunapi");
+  AddBenchmark<std::string>(env, binding, "std::string(1024)",
+                            std::string(1024, 'k'));
+  AddBenchmark<std::u16string>(env, binding, "std::u16string(8)",
+                               u"kizunapi");
+  AddBenchmark<std::u16string>(env, binding, "std::u16string(1024)",
+                               std::u16string(1024, u'k'));
+  AddBenchmark(env, binding, "std::vector<int>(1000)",
+               MakeVector(1000, &IntAt));
+  AddBenchmark(env, binding, "std::vector<double>(1000)",
+               MakeVector(1000, &DoubleAt));
+  AddBenchmark(env, binding, "ki::TypedVector<double>(1000)",
+               ki::TypedVector<double>(MakeVector(1000, &DoubleAt)));
+  AddBenchmark(env, binding, "std::vector<std::string>(100)",
+               MakeVector(100, &StringAt));
+  AddFromNodeBenchmark<ki::Span<const double>>(
+      env, binding, "ki::Span<const double>(1000)",
+      CreateFloat64Array(env, 1000));
+  AddFromNodeBenchmark<ki::Bytes>(
+      env, binding, "ki::Bytes(8000)", CreateFloat64Array(env, 1000));
+  // Includes the cost of copying the vector before moving it to JS.
+  AddMoveToNodeBenchmark<ki::ExternalTypedArray<double>>(
+      env, binding, "ki::ExternalTypedArray<double>(1000)",
+      MakeVector(1000, &DoubleAt));
+  AddMoveToNodeBenchmark<ki::ExternalBuffer>(
+      env, binding, "ki::ExternalBuffer(1024)", std::string(1024, 'k'));
+  auto ints = MakeVector(100, &IntAt);
+  AddBenchmark(env, binding, "std::set<int>(100)",
+               std::set<int>(ints.begin(), ints.end()));
+  std::map<std::string, int> map;
+  std::unordered_map<std::string, double> unordered_map;
+  for (int i = 0; i < 16; ++i) {
+    map[StringAt(i)] = i;
+    unordered_map[StringAt(i)] = DoubleAt(i);
+  }
+  AddBenchmark(env, binding, "std::map<std::string, int>(16)", map);
+  AddBenchmark(env, binding, "std::unordered_map<std::string, double>(16)",
+               unordered_map);
+  AddBenchmark(env, binding, "std::tuple<int, bool, std::string>",
+               std::tuple<int, bool, std::string>(89, true, "64"));
+  AddBenchmark(env, binding, "std::pair<int, double>",
+               std::pair<int, double>(89, 6.4));
+  // The last alternative is the worst case for FromNode.
+  AddBenchmark(env, binding, "std::variant<bool, int, std::string>",
+               std::variant<bool, int, std::string>("8964"));
+  AddBenchmark(env, binding,
+               "std::variant<std::string, int, std::vector<int>>",
+               std::variant<std::string, int, std::vector<int>>(
+                   std::vector<int>{8, 9, 6, 4}));
+  AddMoveToNodeBenchmark<ki::SymbolHolder>(
+      env, binding, "ki::SymbolFor", ki::SymbolFor("kizunapi"));
+  AddBenchmark(env, binding, "ki::Fields(4)", Rect{8, 9, 6.4, 19.89});
+  AddBenchmark(env, binding, "ki::Set/ki::Get(4)",
+               ManualRect{{8, 9, 6.4, 19.89}});
+  AddToNodeBenchmark(env, binding, "std::vector<Record>(5000)",
+                     MakeRecords());
+  AddToNodeBenchmark(env, binding, "ki::AsJSON<std::vector<Record>>(5000)",
+                     ki::AsJSON(MakeRecords()));
+  AddGetBenchmark(env, binding, "const char*", "width");
+  AddGetBenchmark(env, binding, "ki::Key<>", ki::Key<kWidth>());
+  AddBenchmark(env, binding, "std::optional<int>", std::optional<int>(8964));
+  AddBenchmark(env, binding, "std::optional<int>(nullopt)",
+               std::optional<int>());
+}
@@ -0,0 +1,11 @@
+exports.runBenchmarks = (binding, {measure}) => {
+  for (const name in binding) {
+    const {sample, toNode, fromNode, get} = binding[name]
+    if (toNode)
+      measure(`ToNode ${name}`, (n) => toNode(n))
+    if (fromNode)
+      measure(`FromNode ${name}`, (n) => fromNode(sample, n))
+    if (get)
+      measure(`Get ${name}`, (n) => get(sample, n))
+  }
+}
@@ -4,7 +4,10 @@
 #ifndef KIZUNAPI_H_
 #define KIZUNAPI_H_
 
+#include "src/buffer_types.h"
 #include "src/callback.h"
+#include "src/fields.h"
+#include "src/json.h"
 #include "src/prototype.h"
 #include "src/std_types.h"
 #include "src/wrap_method.h"
@@ -4,6 +4,10 @@
 #ifndef SRC_ARGUMENTS_H_
 #define SRC_ARGUMENTS_H_
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include "src/dict.h"
 #include "src/exception.h"
 
@@ -37,8 +41,8 @@ inline std::string NodeTypeToString(napi_env env, napi_value value) {
   assert(type == napi_object);
   napi_value constructor;
   std::string name;
-  if (Get(env, value, "constructor", &constructor) &&
-      Get(env, constructor, "name", &name)) {
+  if (Get(env, value, Key<internal::kConstructorKey>(), &constructor) &&
+      Get(env, constructor, Key<internal::kNameKey>(), &name)) {
     return name;
   }
   return "Object";
@@ -48,16 +52,57 @@ inline std::string NodeTypeToString(napi_env env, napi_value value) {
 // to make it easier to marshall arguments and return values between V8 and C++.
 class Arguments {
  public:
+  // Number of arguments that can be stored without heap allocation.
+  static constexpr size_t kInlineArgc = 8;
+
   Arguments() = default;
 
-  Arguments(napi_env env, napi_callback_info info) : env_(env), info_(info) {
-    napi_status s = napi_get_cb_info(env, info, &argc_, NULL, NULL, NULL);
-    assert(s == napi_ok);
-    argv_.resize(argc_);
-    s = napi_get_cb_info(env, info, &argc_,
-                         argv_.empty() ? nullptr : &argv_.front(),
-                         &this_, &data_);
+  // The |expected_argc| is the number of arguments the callback reads, which
+  // is usually known at compile time. Arguments are read with one call of
+  // napi_get_cb_info, and only go to heap when there are more arguments than
+  // the inline storage can hold.
+  Arguments(napi_env env, napi_callback_info info,
+            size_t expected_argc = kInlineArgc) : env_(env), info_(info) {
+    size_t capacity = kInlineArgc;
+    if (expected_argc > capacity) {
+      heap_argv_.resize(expected_argc);
+      argv_ = heap_argv_.data();
+      capacity = expected_argc;
+    }
+    argc_ = capacity;
+    napi_status s = napi_get_cb_info(env, info, &argc_, argv_, &this_, &data_);
     assert(s == napi_ok);
+    if (argc_ > capacity) {
+      heap_argv_.resize(argc_);
+      argv_ = heap_argv_.data();
+      s = napi_get_cb_info(env, info, &argc_, argv_, nullptr, nullptr);
+      assert(s == napi_ok);
+    }
+  }
+
+  Arguments(const Arguments& other) {
+    *this = other;
+  }
+
+  Arguments& operator=(const Arguments& other) {
+    if (this != &other) {
+      env_ = other.env_;
+      info_ = other.info_;
+      argc_ = other.argc_;
+      heap_argv_ = other.heap_argv_;
+      if (heap_argv_.empty()) {
+        argv_ = inline_argv_;
+        std::copy(other.inline_argv_, other.inline_argv_ + kInlineArgc,
+                  inline_argv_);
+      } else {
+        argv_ = heap_argv_.data();
+      }
+      this_ = other.this_;
+      data_ = other.data_;
+      next_ = other.next_;
+      insufficient_arguments_ = other.insufficient_arguments_;
+    }
+    return *this;
   }
 
   ~Arguments() = default;
@@ -140,7 +185,9 @@ class Arguments {
   napi_callback_info info_;
 
   size_t argc_ = 0;
-  std::vector<napi_value> argv_;
+  napi_value* argv_ = inline_argv_;
+  napi_value inline_argv_[kInlineArgc] = {};
+  std::vector<napi_value> heap_argv_;
   napi_value this_ = nullptr;
   void* data_ = nullptr;
 
@@ -0,0 +1,366 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#ifndef SRC_BUFFER_TYPES_H_
+#define SRC_BUFFER_TYPES_H_
+
+#include <stdint.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/std_types.h"
+
+namespace ki {
+
+// A view of the memory of a TypedArray, Buffer, ArrayBuffer or DataView.
+//
+// The memory is owned by the JS object and no copy is made, so the view must
+// not be used after the JS object could have been garbage collected, which
+// usually means it should not be stored beyond the function call receiving
+// it.
+template<typename T>
+class Span {
+ public:
+  Span() = default;
+  Span(T* data, size_t size) : data_(data), size_(size) {}
+
+  T& operator[](size_t index) const { return data_[index]; }
+
+  T* begin() const { return data_; }
+  T* end() const { return data_ + size_; }
+
+  T* data() const { return data_; }
+  size_t size() const { return size_; }
+  size_t size_bytes() const { return size_ * sizeof(T); }
+  bool empty() const { return size_ == 0; }
+
+ private:
+  T* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+// The raw bytes of any TypedArray, Buffer, ArrayBuffer or DataView.
+class Bytes : public Span<uint8_t> {
+ public:
+  using Span<uint8_t>::Span;
+};
+
+namespace internal {
+
+// Map C++ element types to TypedArray types.
+template<typename T>
+struct TypedArrayTraits {};
+
+#define KI_TYPED_ARRAY_TRAITS(T, array_type, array_name) \
+  template<> \
+  struct TypedArrayTraits<T> { \
+    static constexpr const char* name = array_name; \
+    static constexpr napi_typedarray_type type = array_type; \
+    static inline bool Accepts(napi_typedarray_type t) { \
+      return t == array_type; \
+    } \
+  }
+
+KI_TYPED_ARRAY_TRAITS(int8_t, napi_int8_array, "Int8Array");
+KI_TYPED_ARRAY_TRAITS(int16_t, napi_int16_array, "Int16Array");
+KI_TYPED_ARRAY_TRAITS(uint16_t, napi_uint16_array, "Uint16Array");
+KI_TYPED_ARRAY_TRAITS(int32_t, napi_int32_array, "Int32Array");
+KI_TYPED_ARRAY_TRAITS(uint32_t, napi_uint32_array, "Uint32Array");
+KI_TYPED_ARRAY_TRAITS(float, napi_float32_array, "Float32Array");
+KI_TYPED_ARRAY_TRAITS(double, napi_float64_array, "Float64Array");
+KI_TYPED_ARRAY_TRAITS(int64_t, napi_bigint64_array, "BigInt64Array");
+KI_TYPED_ARRAY_TRAITS(uint64_t, napi_biguint64_array, "BigUint64Array");
+
+#undef KI_TYPED_ARRAY_TRAITS
+
+// Uint8ClampedArray and Buffer both have uint8_t elements.
+template<>
+struct TypedArrayTraits<uint8_t> {
+  static constexpr const char* name = "Uint8Array";
+  static constexpr napi_typedarray_type type = napi_uint8_array;
+  static inline bool Accepts(napi_typedarray_type t) {
+    return t == napi_uint8_array || t == napi_uint8_clamped_array;
+  }
+};
+
+// Read the memory of a TypedArray, Buffer, ArrayBuffer or DataView. For
+// objects other than TypedArray the |type| is set to std::nullopt.
+inline bool GetBufferInfo(napi_env env, napi_value value,
+                          void** data, size_t* byte_length,
+                          std::optional<napi_typedarray_type>* type) {
+  bool is_type = false;
+  if (napi_is_typedarray(env, value, &is_type) == napi_ok && is_type) {
+    napi_typedarray_type array_type;
+    size_t length;
+    if (napi_get_typedarray_info(env, value, &array_type, &length, data,
+                                 nullptr, nullptr) != napi_ok) {
+      return false;
+    }
+    // Node does not export the element size, compute it from the type.
+    size_t element_size = 1;
+    switch (array_type) {
+      case napi_int16_array:
+      case napi_uint16_array:
+        element_size = 2;
+        break;
+      case napi_int32_array:
+      case napi_uint32_array:
+      case napi_float32_array:
+        element_size = 4;
+        break;
+      case napi_float64_array:
+      case napi_bigint64_array:
+      case napi_biguint64_array:
+        element_size = 8;
+        break;
+      default:
+        break;
+    }
+    *byte_length = length * element_size;
+    *type = array_type;
+    return true;
+  }
+  if (napi_is_arraybuffer(env, value, &is_type) == napi_ok && is_type) {
+    *type = std::nullopt;
+    return napi_get_arraybuffer_info(env, value, data, byte_length) == napi_ok;
+  }
+  if (napi_is_dataview(env, value, &is_type) == napi_ok && is_type) {
+    *type = std::nullopt;
+    return napi_get_dataview_info(env, value, byte_length, data,
+                                  nullptr, nullptr) == napi_ok;
+  }
+  return false;
+}
+
+// Return the memory held by containers.
+template<typename T>
+inline void* DataOf(std::vector<T>& vec) { return vec.data(); }
+template<typename T>
+inline void* DataOf(std::unique_ptr<T[]>& ptr) { return ptr.get(); }
+inline void* DataOf(std::string& str) { return str.data(); }
+
+// Holds the ownership of C++ memory until it is transferred to a JS object.
+class ExternalMemory {
+ public:
+  ExternalMemory(ExternalMemory&& other)
+      : owner_(other.owner_),
+        data_(other.data_),
+        byte_length_(other.byte_length_),
+        finalize_(other.finalize_) {
+    other.owner_ = nullptr;
+  }
+
+  ~ExternalMemory() {
+    if (owner_)
+      finalize_(nullptr, nullptr, owner_);
+  }
+
+  ExternalMemory& operator=(const ExternalMemory&) = delete;
+  ExternalMemory(const ExternalMemory&) = delete;
+
+  // Create an ArrayBuffer that frees the memory when garbage collected.
+  napi_status ToArrayBuffer(napi_env env, napi_value* result) {
+    if (byte_length_ == 0)
+      return napi_create_arraybuffer(env, 0, nullptr, result);
+    napi_status s = napi_create_external_arraybuffer(
+        env, data_, byte_length_, finalize_, owner_, result);
+    if (s == napi_ok) {
+      owner_ = nullptr;
+      return s;
+    }
+    // Runtimes with V8 sandbox enabled do not allow external memory.
+    if (s != napi_no_external_buffers_allowed)
+      return s;
+    void* data;
+    s = napi_create_arraybuffer(env, byte_length_, &data, result);
+    if (s == napi_ok)
+      std::memcpy(data, data_, byte_length_);
+    return s;
+  }
+
+  // Create a Buffer that frees the memory when garbage collected.
+  napi_status ToBuffer(napi_env env, napi_value* result) {
+    if (byte_length_ == 0)
+      return napi_create_buffer(env, 0, nullptr, result);
+    napi_status s = napi_create_external_buffer(
+        env, byte_length_, data_, finalize_, owner_, result);
+    if (s == napi_ok) {
+      owner_ = nullptr;
+      return s;
+    }
+    if (s != napi_no_external_buffers_allowed)
+      return s;
+    return napi_create_buffer_copy(env, byte_length_, data_, nullptr, result);
+  }
+
+  size_t byte_length() const { return byte_length_; }
+
+ protected:
+  // The |owner| is moved to heap so the address of its memory is stable.
+  template<typename Owner>
+  ExternalMemory(Owner&& owner, size_t byte_length)
+      : owner_(new Owner(std::move(owner))),
+        data_(DataOf(*static_cast<Owner*>(owner_))),
+        byte_length_(byte_length),
+        finalize_([](napi_env, void*, void* owner) {
+          delete static_cast<Owner*>(owner);
+        }) {}
+
+ private:
+  void* owner_;
+  void* data_;
+  size_t byte_length_;
+  napi_finalize finalize_;
+};
+
+}  // namespace internal
+
+// Transfer the ownership of C++ memory to a TypedArray, which frees the
+// memory when garbage collected, so returning large results to JS does not
+// copy or convert elements:
+//   ki::ExternalTypedArray<float> GetSamples() {
+//     std::vector<float> samples = ...;
+//     return ki::ExternalTypedArray<float>(std::move(samples));
+//   }
+template<typename T>
+class ExternalTypedArray : public internal::ExternalMemory {
+ public:
+  explicit ExternalTypedArray(std::vector<T>&& vec)
+      : ExternalMemory(std::move(vec), vec.size() * sizeof(T)) {}
+  ExternalTypedArray(std::unique_ptr<T[]> data, size_t size)
+      : ExternalMemory(std::move(data), size * sizeof(T)) {}
+};
+
+// Like ExternalTypedArray but creates a Node Buffer.
+class ExternalBuffer : public internal::ExternalMemory {
+ public:
+  explicit ExternalBuffer(std::string&& str)
+      : ExternalMemory(std::move(str), str.size()) {}
+  explicit ExternalBuffer(std::vector<uint8_t>&& vec)
+      : ExternalMemory(std::move(vec), vec.size()) {}
+  ExternalBuffer(std::unique_ptr<uint8_t[]> data, size_t size)
+      : ExternalMemory(std::move(data), size) {}
+};
+
+// A vector of numbers that is converted to a TypedArray of the same element
+// type with one copy, instead of an Array converted element by element. Both
+// TypedArrays and plain arrays are accepted when converting from JS:
+//   ki::TypedVector<double> GetSamples();
+//   void SetSamples(ki::TypedVector<double> samples);
+template<typename T>
+class TypedVector : public std::vector<T> {
+ public:
+  using std::vector<T>::vector;
+  TypedVector(std::vector<T>&& vec)  // NOLINT(runtime/explicit)
+      : std::vector<T>(std::move(vec)) {}
+};
+
+template<typename T>
+struct Type<Span<T>> {
+  using Element = std::remove_const_t<T>;
+  static constexpr const char* name =
+      internal::TypedArrayTraits<Element>::name;
+  static constexpr uint32_t kinds = kObjectKind;
+  // TypedArrays must have the same element type, while the untyped memory of
+  // ArrayBuffer and DataView must be aligned to elements.
+  static std::optional<Span<T>> FromNode(napi_env env, napi_value value) {
+    void* data;
+    size_t byte_length;
+    std::optional<napi_typedarray_type> type;
+    if (!internal::GetBufferInfo(env, value, &data, &byte_length, &type))
+      return std::nullopt;
+    if (type) {
+      if (!internal::TypedArrayTraits<Element>::Accepts(*type))
+        return std::nullopt;
+    } else if (byte_length % sizeof(T) != 0 ||
+               reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+      return std::nullopt;
+    }
+    return Span<T>(static_cast<T*>(data), byte_length / sizeof(T));
+  }
+};
+
+template<>
+struct Type<Bytes> {
+  static constexpr const char* name = "Buffer";
+  static constexpr uint32_t kinds = kObjectKind;
+  static std::optional<Bytes> FromNode(napi_env env, napi_value value) {
+    void* data;
+    size_t byte_length;
+    std::optional<napi_typedarray_type> type;
+    if (!internal::GetBufferInfo(env, value, &data, &byte_length, &type))
+      return std::nullopt;
+    return Bytes(static_cast<uint8_t*>(data), byte_length);
+  }
+};
+
+template<typename T>
+struct Type<TypedVector<T>> {
+  static constexpr const char* name = internal::TypedArrayTraits<T>::name;
+  static constexpr uint32_t kinds = kObjectKind | kArrayKind;
+  static napi_status ToNode(napi_env env,
+                            const TypedVector<T>& value,
+                            napi_value* result) {
+    napi_value buffer;
+    void* data;
+    size_t byte_length = value.size() * sizeof(T);
+    napi_status s = napi_create_arraybuffer(env, byte_length, &data, &buffer);
+    if (s != napi_ok)
+      return s;
+    if (byte_length > 0)
+      std::memcpy(data, value.data(), byte_length);
+    return napi_create_typedarray(env, internal::TypedArrayTraits<T>::type,
+                                  value.size(), buffer, 0, result);
+  }
+  static std::optional<TypedVector<T>> FromNode(napi_env env,
+                                                napi_value value) {
+    bool is_typedarray = false;
+    if (napi_is_typedarray(env, value, &is_typedarray) != napi_ok)
+      return std::nullopt;
+    if (!is_typedarray) {
+      std::optional<std::vector<T>> vec =
+          Type<std::vector<T>>::FromNode(env, value);
+      if (!vec)
+        return std::nullopt;
+      return TypedVector<T>(std::move(*vec));
+    }
+    std::optional<Span<const T>> span =
+        Type<Span<const T>>::FromNode(env, value);
+    if (!span)
+      return std::nullopt;
+    return TypedVector<T>(span->begin(), span->end());
+  }
+};
+
+template<typename T>
+struct Type<ExternalTypedArray<T>> {
+  static constexpr const char* name = internal::TypedArrayTraits<T>::name;
+  static napi_status ToNode(napi_env env,
+                            ExternalTypedArray<T> value,
+                            napi_value* result) {
+    napi_value buffer;
+    napi_status s = value.ToArrayBuffer(env, &buffer);
+    if (s != napi_ok)
+      return s;
+    return napi_create_typedarray(env, internal::TypedArrayTraits<T>::type,
+                                  value.byte_length() / sizeof(T), buffer, 0,
+                                  result);
+  }
+};
+
+template<>
+struct Type<ExternalBuffer> {
+  static constexpr const char* name = "Buffer";
+  static inline napi_status ToNode(napi_env env,
+                                   ExternalBuffer value,
+                                   napi_value* result) {
+    return value.ToBuffer(env, result);
+  }
+};
+
+}  // namespace ki
+
+#endif  // SRC_BUFFER_TYPES_H_
@@ -52,6 +52,7 @@ template<typename ReturnType, typename... ArgTypes>
 struct Type<std::function<ReturnType(ArgTypes...)>> {
   using Sig = ReturnType(ArgTypes...);
   static constexpr const char* name = "Function";
+  static constexpr uint32_t kinds = kFunctionKind;
   static inline napi_status ToNode(napi_env env,
                                    std::function<Sig> value,
                                    napi_value* result) {
@@ -96,6 +97,29 @@ inline MemberFunctionHolder<T> MemberFunction(T func) {
   return MemberFunctionHolder<T>{func};
 }
 
+// Bind a function or member function known at compile time, for example
+// ki::Fn<&Class::Method>(). Unlike passing the function pointer directly, the
+// call is dispatched without std::function and no holder is allocated for the
+// created JS function.
+template<auto func, int flags = 0>
+struct Fn {
+  static_assert(internal::is_function_pointer<decltype(func)>::value ||
+                std::is_member_function_pointer_v<decltype(func)>,
+                "Fn only accepts function pointers and member function "
+                "pointers.");
+};
+
+template<auto func, int flags>
+struct Type<Fn<func, flags>> {
+  static constexpr const char* name = "Function";
+  static inline napi_status ToNode(napi_env env, Fn<func, flags>,
+                                   napi_value* result) {
+    return napi_create_function(
+        env, nullptr, 0, &internal::FunctionInvoker<func, flags>::Invoke,
+        nullptr, result);
+  }
+};
+
 }  // namespace ki
 
 #endif  // SRC_CALLBACK_H_
@@ -107,13 +107,6 @@ struct ArgConverter<std::function<Sig>> {
 // For advanced use cases, we allow callers to request the unparsed Arguments
 // object and poke around in it directly.
 template<>
-struct ArgConverter<Arguments> {
-  static inline std::optional<Arguments> GetNext(
-      Arguments* args, int flags, bool is_first) {
-    return *args;
-  }
-};
-template<>
 struct ArgConverter<Arguments*> {
   static inline std::optional<Arguments*> GetNext(
       Arguments* args, int flags, bool is_first) {
@@ -145,6 +138,38 @@ struct ArgumentHolder {
   }
 };
 
+// Arguments parameters refer to the invoker's Arguments, so a callback taking
+// "const Arguments&" gets no copy, and one taking "Arguments" gets one copy
+// when the parameter is initialized.
+template<typename ArgType>
+struct ArgumentsHolder {
+  std::optional<std::reference_wrapper<ArgType>> value;
+
+  ArgumentsHolder(Arguments* args, int flags) : value(*args) {}
+};
+
+template<size_t index>
+struct ArgumentHolder<index, Arguments> : ArgumentsHolder<Arguments> {
+  using ArgumentsHolder<Arguments>::ArgumentsHolder;
+};
+template<size_t index>
+struct ArgumentHolder<index, Arguments&> : ArgumentsHolder<Arguments> {
+  using ArgumentsHolder<Arguments>::ArgumentsHolder;
+};
+template<size_t index>
+struct ArgumentHolder<index, const Arguments&>
+    : ArgumentsHolder<const Arguments> {
+  using ArgumentsHolder<const Arguments>::ArgumentsHolder;
+};
+
+// Callbacks taking "Arguments&&" may move from it, so they get a copy.
+template<size_t index>
+struct ArgumentHolder<index, Arguments&&> {
+  std::optional<Arguments> value;
+
+  ArgumentHolder(Arguments* args, int flags) : value(*args) {}
+};
+
 // CallbackHolder holds information about a std::function.
 template<typename Sig>
 struct CallbackHolder {
@@ -217,6 +242,12 @@ class Invoker<IndicesHolder<indices...>, ArgTypes...>
     return callback(std::move(*ArgumentHolder<indices, ArgTypes>::value)...);
   }
 
+  template<auto func>
+  decltype(auto) DispatchToFunction() {
+    return std::invoke(func,
+                       std::move(*ArgumentHolder<indices, ArgTypes>::value)...);
+  }
+
  private:
   static bool And() { return true; }
   template<typename... T>
@@ -237,12 +268,12 @@ struct CallbackInvoker<ReturnType(ArgTypes...)> {
   using HolderT = CallbackHolder<ReturnType(ArgTypes...)>;
   using ReturnLocalType = std::optional<std::decay_t<ReturnType>>;
   static inline ReturnLocalType Invoke(napi_env env, napi_callback_info info) {
-    Arguments args(env, info);
+    Arguments args(env, info, sizeof...(ArgTypes));
     return Invoke(&args);
   }
   static inline ReturnLocalType Invoke(napi_env env, napi_callback_info info,
                                        const HolderT* holder) {
-    Arguments args(env, info);
+    Arguments args(env, info, sizeof...(ArgTypes));
     return Invoke(&args, holder);
   }
   static inline ReturnLocalType Invoke(Arguments* args) {
@@ -279,12 +310,12 @@ template<typename... ArgTypes>
 struct CallbackInvoker<void(ArgTypes...)> {
   using HolderT = CallbackHolder<void(ArgTypes...)>;
   static inline void Invoke(napi_env env, napi_callback_info info) {
-    Arguments args(env, info);
+    Arguments args(env, info, sizeof...(ArgTypes));
     Invoke(&args);
   }
   static inline void Invoke(napi_env env, napi_callback_info info,
                             const HolderT* holder) {
-    Arguments args(env, info);
+    Arguments args(env, info, sizeof...(ArgTypes));
     Invoke(&args, holder);
   }
   static inline void Invoke(Arguments* args) {
@@ -390,6 +421,42 @@ inline napi_status CreateNodeFunction(napi_env env, T func, napi_value* result,
   return napi_ok;
 }
 
+// Create a napi_callback that calls |func|, which is known at compile time,
+// so there is no need to store the function in a CallbackHolder.
+template<auto func, int flags,
+         typename Sig = typename FunctorTraits<decltype(func)>::RunType>
+struct FunctionInvoker {};
+
+template<auto func, int flags, typename ReturnType, typename... ArgTypes>
+struct FunctionInvoker<func, flags, ReturnType(ArgTypes...)> {
+  static constexpr int kFlags =
+      FunctorTraits<decltype(func)>::is_method ? HolderIsFirstArgument | flags
+                                               : flags;
+
+  static napi_value Invoke(napi_env env, napi_callback_info info) {
+    Arguments args(env, info, sizeof...(ArgTypes));
+    using Indices = typename IndicesGenerator<sizeof...(ArgTypes)>::type;
+    Invoker<Indices, ArgTypes...> invoker(&args, kFlags);
+    if (!invoker.IsOK())
+      return nullptr;
+#if defined(__cpp_exceptions)
+    try {
+#endif
+      if constexpr (std::is_void_v<ReturnType>) {
+        invoker.template DispatchToFunction<func>();
+        return nullptr;
+      } else {
+        return ToNodeValue(env, invoker.template DispatchToFunction<func>());
+      }
+#if defined(__cpp_exceptions)
+    } catch (const std::exception& e) {
+      ThrowError(env, e.what());
+      return nullptr;
+    }
+#endif
+  }
+};
+
 // Helper to invoke a V8 function with C++ parameters.
 template<typename Sig>
 struct V8FunctionInvoker {};
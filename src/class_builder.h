@@ -0,0 +1,220 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#ifndef SRC_CLASS_BUILDER_H_
+#define SRC_CLASS_BUILDER_H_
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "src/callback.h"
+#include "src/property.h"
+
+namespace ki {
+
+namespace internal {
+
+// A prototype member whose value is created on first access.
+struct LazyValue {
+  std::function<napi_value(napi_env)> key;
+  std::function<napi_value(napi_env)> create;
+  // Weak reference to the prototype holding the member.
+  Persistent prototype;
+};
+
+// Create the value and replace the accessor on prototype with it.
+inline napi_value GetLazyValue(napi_env env, napi_callback_info info) {
+  void* data;
+  if (napi_get_cb_info(env, info, nullptr, nullptr, nullptr, &data) !=
+      napi_ok) {
+    return nullptr;
+  }
+  auto* lazy = static_cast<LazyValue*>(data);
+  napi_value value = lazy->create(env);
+  napi_value prototype = lazy->prototype.Value();
+  if (!value || !prototype)
+    return value;
+  napi_property_descriptor descriptor = {};
+  descriptor.name = lazy->key(env);
+  descriptor.value = value;
+  descriptor.attributes = napi_default_jsproperty;
+  napi_define_properties(env, prototype, 1, &descriptor);
+  return value;
+}
+
+// Assignments define the value on |this|, same with assigning to a member
+// inherited from prototype.
+inline napi_value SetLazyValue(napi_env env, napi_callback_info info) {
+  size_t argc = 1;
+  napi_value value, self;
+  void* data;
+  if (napi_get_cb_info(env, info, &argc, &value, &self, &data) != napi_ok ||
+      argc < 1) {
+    return nullptr;
+  }
+  napi_property_descriptor descriptor = {};
+  descriptor.name = static_cast<LazyValue*>(data)->key(env);
+  descriptor.value = value;
+  descriptor.attributes = napi_default_jsproperty;
+  napi_define_properties(env, self, 1, &descriptor);
+  return nullptr;
+}
+
+}  // namespace internal
+
+// Collects the members of a class, which are then defined in batch when the
+// class is created instead of one call for each member. It is received by
+// Type<T>::Define:
+//   static void Define(ki::ClassBuilder* builder) {
+//     builder->Set("open", ki::Fn<&File::Open>(),
+//                  "close", &File::Close);
+//     builder->DefineProperties(ki::Property("path", &File::path));
+//     builder->SetStatic("create", &File::Create);
+//   }
+class ClassBuilder {
+ public:
+  explicit ClassBuilder(napi_env env) : env_(env) {}
+
+  ClassBuilder& operator=(const ClassBuilder&) = delete;
+  ClassBuilder(const ClassBuilder&) = delete;
+
+  napi_env Env() const { return env_; }
+
+  // Add key/value pairs to the prototype, like ki::Set.
+  template<typename Key, typename Value, typename... ArgTypes>
+  void Set(Key&& key, Value&& value, ArgTypes&&... args) {
+    AddValue(std::forward<Key>(key), std::forward<Value>(value),
+             napi_default_jsproperty);
+    if constexpr (sizeof...(args) > 0)
+      Set(std::forward<ArgTypes>(args)...);
+  }
+
+  // Add key/value pairs to the constructor.
+  template<typename Key, typename Value, typename... ArgTypes>
+  void SetStatic(Key&& key, Value&& value, ArgTypes&&... args) {
+    AddValue(std::forward<Key>(key), std::forward<Value>(value),
+             static_cast<napi_property_attributes>(napi_default_jsproperty |
+                                                   napi_static));
+    if constexpr (sizeof...(args) > 0)
+      SetStatic(std::forward<ArgTypes>(args)...);
+  }
+
+  // Like Set but the values are only created when they are accessed for the
+  // first time, which is useful for classes with lots of methods.
+  template<typename Key, typename Value, typename... ArgTypes>
+  void SetLazy(Key key, Value value, ArgTypes... args) {
+    auto lazy = std::make_unique<internal::LazyValue>();
+    lazy->key = [key](napi_env env) {
+      return ToNodeValue(env, key);
+    };
+    lazy->create = [value](napi_env env) {
+      return ToNodeValue(env, value);
+    };
+    napi_property_descriptor descriptor = {};
+    descriptor.name = ToNodeValue(env_, key);
+    descriptor.getter = &internal::GetLazyValue;
+    descriptor.setter = &internal::SetLazyValue;
+    descriptor.data = lazy.get();
+    descriptor.attributes = static_cast<napi_property_attributes>(
+        napi_enumerable | napi_configurable);
+    descriptors_.push_back(descriptor);
+    holders_->lazy_values.push_back(std::move(lazy));
+    if constexpr (sizeof...(args) > 0)
+      SetLazy(std::move(args)...);
+  }
+
+  // Add properties to the prototype, like ki::DefineProperties.
+  template<typename... ArgTypes,
+           typename = typename std::enable_if<
+               internal::is_all_same<ArgTypes..., Property>::value>::type>
+  void DefineProperties(ArgTypes... props) {
+    (AddProperty(std::move(props)), ...);
+  }
+
+  template<typename... Props>
+  void DefineProperties(Properties<Props...>) {
+    (descriptors_.push_back(Props::Descriptor()), ...);
+  }
+
+  // Define the class with the collected members. The static members are
+  // passed to napi_define_class, while the prototype members are defined with
+  // one napi_define_properties call, because napi_define_class adds receiver
+  // checks to them which reject objects created by Object.create.
+  napi_status DefineClass(const char* name, napi_callback constructor,
+                          void* data, napi_value* result) {
+    auto members = std::stable_partition(
+        descriptors_.begin(), descriptors_.end(),
+        [](const napi_property_descriptor& d) {
+          return d.attributes & napi_static;
+        });
+    size_t statics_count = members - descriptors_.begin();
+    napi_status s = napi_define_class(
+        env_, name, NAPI_AUTO_LENGTH, constructor, data, statics_count,
+        statics_count == 0 ? nullptr : descriptors_.data(), result);
+    if (s != napi_ok)
+      return s;
+    if (statics_count < descriptors_.size()) {
+      napi_value prototype;
+      if (!Get(env_, *result, Key<internal::kPrototypeKey>(), &prototype))
+        return napi_generic_failure;
+      s = napi_define_properties(env_, prototype,
+                                 descriptors_.size() - statics_count,
+                                 &*members);
+      if (s != napi_ok)
+        return s;
+      for (auto& lazy : holders_->lazy_values)
+        lazy->prototype = Persistent(env_, prototype, 0);
+    }
+    if (holders_->properties.empty() && holders_->lazy_values.empty())
+      return napi_ok;
+    return AddToFinalizer(env_, *result, std::move(holders_));
+  }
+
+ private:
+  template<typename Key, typename Value>
+  void AddValue(Key&& key, Value&& value,
+                napi_property_attributes attributes) {
+    napi_property_descriptor descriptor = {};
+    descriptor.name = ToNodeValue(env_, std::forward<Key>(key));
+    descriptor.attributes = attributes;
+    descriptor.method = MethodOf(value);
+    if (!descriptor.method)
+      descriptor.value = ToNodeValue(env_, std::forward<Value>(value));
+    descriptors_.push_back(descriptor);
+  }
+
+  void AddProperty(Property prop) {
+    std::unique_ptr<Property> holder;
+    descriptors_.push_back(
+        internal::PropertyToDescriptor(env_, std::move(prop), &holder));
+    holders_->properties.push_back(std::move(holder));
+  }
+
+  // Functions known at compile time are passed as descriptor methods, which
+  // skips converting them with ToNode. The JS functions are still created
+  // when the class is defined, use SetLazy to defer that to first access.
+  template<typename Value>
+  static napi_callback MethodOf(const Value&) {
+    return nullptr;
+  }
+
+  template<auto func, int flags>
+  static napi_callback MethodOf(const Fn<func, flags>&) {
+    return &internal::FunctionInvoker<func, flags>::Invoke;
+  }
+
+  napi_env env_;
+  std::vector<napi_property_descriptor> descriptors_;
+  // The data of descriptors, which are freed with the class.
+  struct Holders {
+    std::vector<std::unique_ptr<Property>> properties;
+    std::vector<std::unique_ptr<internal::LazyValue>> lazy_values;
+  };
+  std::unique_ptr<Holders> holders_ = std::make_unique<Holders>();
+};
+
+}  // namespace ki
+
+#endif  // SRC_CLASS_BUILDER_H_
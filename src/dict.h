@@ -4,7 +4,7 @@
 #ifndef SRC_DICT_H_
 #define SRC_DICT_H_
 
-#include "src/types.h"
+#include "src/key.h"
 
 namespace ki {
 
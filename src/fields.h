@@ -0,0 +1,94 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#ifndef SRC_FIELDS_H_
+#define SRC_FIELDS_H_
+
+#include <tuple>
+
+#include "src/dict.h"
+
+namespace ki {
+
+// A member of a plain struct, which is converted to the property |name| of
+// object:
+//   constexpr char kX[] = "x";
+//   ki::Field<kX, &Point::x>
+template<const char* name, auto member>
+struct Field {
+  static_assert(std::is_member_object_pointer_v<decltype(member)>,
+                "Field only accepts member object pointers.");
+  using ClassType =
+      typename internal::ExtractMemberPointer<decltype(member)>::ClassType;
+  using MemberType =
+      typename internal::ExtractMemberPointer<decltype(member)>::MemberType;
+
+  static napi_status Descriptor(napi_env env, const ClassType& value,
+                                napi_property_descriptor* descriptor) {
+    descriptor->utf8name = name;
+    descriptor->attributes = napi_default_jsproperty;
+    return ConvertToNode(env, value.*member, &descriptor->value);
+  }
+
+  static bool Read(napi_env env, napi_value object, ClassType* out) {
+    napi_value value;
+    if (napi_get_named_property(env, object, name, &value) != napi_ok)
+      return false;
+    std::optional<MemberType> result = FromNodeTo<MemberType>(env, value);
+    if (!result)
+      return false;
+    out->*member = std::move(*result);
+    return true;
+  }
+};
+
+// Converter for plain structs, which converts the fields to and from the
+// properties of objects:
+//   template<>
+//   struct Type<Point> : ki::Fields<ki::Field<kX, &Point::x>,
+//                                   ki::Field<kY, &Point::y>> {
+//     static constexpr const char* name = "Point";
+//   };
+// The objects are created with all properties defined in one call in the
+// order of fields, so they share the same hidden class. Missing properties are
+// read as undefined, which only std::optional fields accept.
+//
+// The keys are passed to Node-API as UTF-8 names, which Node creates as
+// internalized strings. Before Node-API 10 this is faster than ki::Key, whose
+// cached strings are read back from a JS array.
+template<typename... FieldTypes>
+struct Fields {
+  static_assert(sizeof...(FieldTypes) > 0, "No fields to convert.");
+  using T = typename std::tuple_element_t<
+      0, std::tuple<FieldTypes...>>::ClassType;
+  static_assert((std::is_same_v<T, typename FieldTypes::ClassType> && ...),
+                "Fields must be members of the same class.");
+
+  static constexpr uint32_t kinds = kObjectKind | kArrayKind | kFunctionKind;
+  static napi_status ToNode(napi_env env, const T& value, napi_value* result) {
+    napi_property_descriptor descriptors[sizeof...(FieldTypes)] = {};
+    size_t i = 0;
+    napi_status s = napi_ok;
+    ((s = FieldTypes::Descriptor(env, value, &descriptors[i++]),
+      s == napi_ok) && ...);
+    if (s != napi_ok)
+      return s;
+    s = napi_create_object(env, result);
+    if (s != napi_ok)
+      return s;
+    return napi_define_properties(env, *result, sizeof...(FieldTypes),
+                                  descriptors);
+  }
+  static std::optional<T> FromNode(napi_env env, napi_value value) {
+    if (!internal::IsObject(env, value))
+      return std::nullopt;
+    T result;
+    if (!(FieldTypes::Read(env, value, &result) && ...))
+      return std::nullopt;
+    return result;
+  }
+};
+
+}  // namespace ki
+
+#endif  // SRC_FIELDS_H_
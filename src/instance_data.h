@@ -4,10 +4,16 @@
 #ifndef SRC_INSTANCE_DATA_H_
 #define SRC_INSTANCE_DATA_H_
 
+#include <functional>
 #include <map>
+#include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "src/map.h"
+#include "src/wrap_data.h"
+#include "src/wrapper_table.h"
 
 namespace ki {
 
@@ -30,6 +36,11 @@ struct TopClass<T, typename std::enable_if<std::is_class<
 class InstanceData {
  public:
   static InstanceData* Get(napi_env env) {
+    // Most calls on a thread come from the same env, so remember the last
+    // result to avoid calling napi_get_instance_data.
+    Cache& cache = GetCache();
+    if (cache.env == env)
+      return cache.data;
     void* data = nullptr;
     napi_status s = napi_get_instance_data(env, &data);
     assert(s == napi_ok);
@@ -42,18 +53,32 @@ class InstanceData {
     }
     InstanceData* ret = static_cast<InstanceData*>(data);
     assert(ret->tag_ == 0x8964);
+    cache = {env, ret};
     return ret;
   }
 
-  // Get or create a object attached to an object.
+  // Get or create a object attached to an object. The tables are stored in a
+  // WeakMap so they live as long as their objects without adding properties
+  // to them, and wrappers also keep a weak reference to their tables in their
+  // native data so the lookup does not go through the WeakMap.
   Map GetOrCreateAttachedTable(napi_value object) {
-    Map lookup = attached_tables_.ToLocal<Map>();
     napi_value value;
-    if (lookup.Get(object, &value))
-      return Map(env_, value);
-    Map table(env_);
-    lookup.Set(object, table.Value());
-    return table;
+    internal::WrapData* wrap_data = internal::GetWrapData(env_, object);
+    if (wrap_data && !wrap_data->attached_table.IsEmpty()) {
+      value = wrap_data->attached_table.Value();
+      if (value)
+        return Map(env_, value, false, true);
+    }
+    if (attached_tables_.IsEmpty())
+      attached_tables_ = Persistent(env_, WeakMap(env_).Value());
+    Map lookup(env_, attached_tables_.Value(), true, true);
+    if (!lookup.Get(object, &value)) {
+      value = Map(env_).Value();
+      lookup.Set(object, value);
+    }
+    if (wrap_data)
+      wrap_data->attached_table = Persistent(env_, value, 0);
+    return Map(env_, value, false, true);
   }
 
   // Add and get persistent handles.
@@ -73,65 +98,207 @@ class InstanceData {
     strong_refs_.erase(key);
   }
 
-  // In C++ the address of a class's first member data is equivalent to the
-  // address of the class itself, so 1 pointer can actually represent 2
-  // different instances. To avoid duplicate key for different instances, we
-  // also include typename as part of the key.
-  using WrapperKey = std::pair<const char*, void*>;
+  // Get and set the constructors and prototypes of classes, indexed by
+  // internal::TypeIndex.
+  bool GetConstructor(size_t index, napi_value* result) const {
+    if (index >= classes_.size() || classes_[index].constructor.IsEmpty())
+      return false;
+    *result = classes_[index].constructor.Value();
+    return true;
+  }
+
+  napi_value GetPrototype(size_t index) const {
+    if (index >= classes_.size() || classes_[index].prototype.IsEmpty())
+      return nullptr;
+    return classes_[index].prototype.Value();
+  }
 
-  // Used to store the results of napi_wrap, it is caller's responsibility to
-  // destroy the result.
+  void SetConstructor(size_t index, napi_value constructor,
+                      napi_value prototype) {
+    if (index >= classes_.size())
+      classes_.resize(index + 1);
+    classes_[index].constructor = Persistent(env_, constructor);
+    classes_[index].prototype = Persistent(env_, prototype);
+  }
+
+  // Get the cached property key of Key<str>, create one if not exist. Before
+  // Node-API 10 strings can not be referenced, so the keys are read from a
+  // referenced array.
+  napi_value GetKey(size_t index, const char* str) {
+    if (index < has_keys_.size() && has_keys_[index]) {
+#if NAPI_VERSION >= 10
+      return keys_[index].Value();
+#else
+      napi_value value;
+      napi_status s = napi_get_element(env_, keys_.Value(), index, &value);
+      assert(s == napi_ok);
+      return value;
+#endif
+    }
+    return CreateKey(index, str);
+  }
+
+  // Get the cached symbol from the global registry.
+  napi_value GetSymbolFor(const char* str) {
+    auto it = symbols_.find(std::string_view(str));
+    if (it != symbols_.end())
+      return it->second.Value();
+    napi_value value;
+    if (node_api_symbol_for(env_, str, NAPI_AUTO_LENGTH, &value) != napi_ok)
+      return nullptr;
+    symbols_.emplace(str, Persistent(env_, value));
+    return value;
+  }
+
+  // Get the cached builtin class |type|, or its function |name|, which is a
+  // method of its prototype when |on_prototype| is true.
+  napi_value GetBuiltin(size_t index, const char* type, const char* name,
+                        bool on_prototype) {
+    if (index < builtins_.size() && !builtins_[index].IsEmpty())
+      return builtins_[index].Value();
+    napi_value global, constructor, holder, result;
+    if (napi_get_global(env_, &global) != napi_ok ||
+        napi_get_named_property(env_, global, type, &constructor) != napi_ok) {
+      return nullptr;
+    }
+    // The functions can also be got from namespace objects like JSON.
+    if (!IsType(env_, constructor, napi_function) &&
+        (!name || on_prototype || !IsType(env_, constructor, napi_object))) {
+      return nullptr;
+    }
+    if (name) {
+      holder = constructor;
+      if ((on_prototype &&
+           !ki::Get(env_, constructor, Key<internal::kPrototypeKey>(),
+                    &holder)) ||
+          napi_get_named_property(env_, holder, name, &result) != napi_ok ||
+          !IsType(env_, result, napi_function)) {
+        return nullptr;
+      }
+    } else {
+      result = constructor;
+    }
+    if (index >= builtins_.size())
+      builtins_.resize(index + 1);
+    builtins_[index] = Persistent(env_, result);
+    return result;
+  }
+
+  // Used to store the results of napi_wrap, the reference is deleted when
+  // the wrapper is deleted.
   template<typename T>
   void AddWrapper(void* ptr, napi_ref ref) {
-    WrapperKey key{internal::TopClass<T>::name, ptr};
-    wrappers_.emplace(key, Persistent(env_, ref));
+    wrappers_.Add(env_, internal::TopClass<T>::name, ptr, ref);
   }
 
   template<typename T>
   bool GetWrapper(void* ptr, napi_value* result) const {
-    WrapperKey key{internal::TopClass<T>::name, ptr};
-    auto it = wrappers_.find(key);
-    if (it == wrappers_.end())
+    napi_ref ref = wrappers_.Get(internal::TopClass<T>::name, ptr);
+    if (!ref)
       return false;
-    *result = it->second.Value();
+    *result = nullptr;
+    napi_get_reference_value(env_, ref, result);
     return *result != nullptr;
   }
 
   template<typename T>
   bool DeleteWrapper(void* ptr) {
-    WrapperKey key{internal::TopClass<T>::name, ptr};
-    auto it = wrappers_.find(key);
-    if (it == wrappers_.end())
-      return false;
-    wrappers_.erase(key);
-    return true;
+    return wrappers_.Delete(env_, internal::TopClass<T>::name, ptr);
   }
 
   size_t GetWrappersCount() const {
-    return wrappers_.size();
+    return wrappers_.Size();
   }
 
  private:
+  napi_value CreateKey(size_t index, const char* str) {
+    napi_value value;
+    if (internal::CreatePropertyKey(env_, str, &value) != napi_ok)
+      return nullptr;
+#if NAPI_VERSION >= 10
+    if (index >= keys_.size())
+      keys_.resize(index + 1);
+    keys_[index] = Persistent(env_, value);
+#else
+    if (napi_set_element(env_, keys_.Value(), index, value) != napi_ok)
+      return nullptr;
+#endif
+    if (index >= has_keys_.size())
+      has_keys_.resize(index + 1);
+    has_keys_[index] = true;
+    return value;
+  }
+
   explicit InstanceData(napi_env env)
-      : env_(env),
-        attached_tables_(env, WeakMap(env)) {}
+      : env_(env)
+#if NAPI_VERSION < 10
+        , keys_(env, CreateArray(env))
+#endif
+        {}
 
+  // Node frees all references on exit whether they belong to user or runtime,
+  // so the references of wrappers are leaked to avoid double free.
   ~InstanceData() {
-    // Node frees all references on exit whether they belong to user or runtime,
-    // so we have to leak them to avoid double free.
-    for (auto& [key, handle] : wrappers_) {
-      handle.Release();
-    }
+    // The data is destroyed on the thread of its env, clear the cache so a
+    // new env created at the same address does not get a dangling pointer.
+    Cache& cache = GetCache();
+    if (cache.data == this)
+      cache = Cache();
+  }
+
+  struct Cache {
+    napi_env env = nullptr;
+    InstanceData* data = nullptr;
+  };
+
+  // Each thread runs its own env, so the cache is thread local.
+  static Cache& GetCache() {
+    static thread_local Cache cache;
+    return cache;
   }
 
   napi_env env_;
   Persistent attached_tables_;
   std::map<void*, Persistent> strong_refs_;
-  std::map<WrapperKey, Persistent> wrappers_;
+  struct ClassRefs {
+    Persistent constructor;
+    Persistent prototype;
+  };
+  std::vector<ClassRefs> classes_;
+  internal::WrapperTable wrappers_;
+  std::vector<bool> has_keys_;
+#if NAPI_VERSION >= 10
+  std::vector<Persistent> keys_;
+#else
+  // Before Node-API 10 only objects can be referenced, so keys are stored in
+  // an array.
+  Persistent keys_;
+#endif
+  // Ordered with transparent comparison so lookups need no std::string.
+  std::map<std::string, Persistent, std::less<>> symbols_;
+  std::vector<Persistent> builtins_;
 
   const int tag_ = 0x8964;
 };
 
+namespace internal {
+
+inline napi_value GetCachedKey(napi_env env, size_t index, const char* str) {
+  return InstanceData::Get(env)->GetKey(index, str);
+}
+
+inline napi_value GetCachedSymbolFor(napi_env env, const char* str) {
+  return InstanceData::Get(env)->GetSymbolFor(str);
+}
+
+inline napi_value GetCachedBuiltin(napi_env env, size_t index,
+                                   const char* type, const char* name,
+                                   bool on_prototype) {
+  return InstanceData::Get(env)->GetBuiltin(index, type, name, on_prototype);
+}
+
+}  // namespace internal
+
 }  // namespace ki
 
 #endif  // SRC_INSTANCE_DATA_H_
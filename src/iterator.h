@@ -8,14 +8,19 @@
 
 namespace ki {
 
-template<typename T>
-bool IterateArray(napi_env env, napi_value arr,
-                  const std::function<bool(uint32_t i, T value)>& visit) {
+// Iterate the elements of |arr|, the |visit| is called with (index, value)
+// for each element and the iteration stops when it returns false. The
+// |reserve| is called with the length before iterating, so containers can
+// allocate memory at once.
+template<typename T, typename Reserve, typename Visit>
+bool IterateArray(napi_env env, napi_value arr, Reserve&& reserve,
+                  Visit&& visit) {
   if (!IsArray(env, arr))
     return false;
   uint32_t length;
   if (napi_get_array_length(env, arr, &length) != napi_ok)
     return false;
+  reserve(length);
   for (uint32_t i = 0; i < length; ++i) {
     napi_value el = nullptr;
     if (napi_get_element(env, arr, i, &el) != napi_ok)
@@ -23,33 +28,45 @@ bool IterateArray(napi_env env, napi_value arr,
     std::optional<T> out = FromNodeTo<T>(env, el);
     if (!out)
       return false;
-    if (!visit(i, *out))
+    if (!visit(i, std::move(*out)))
       return false;
   }
   return true;
 }
 
-template<typename K, typename V>
-bool IterateObject(napi_env env, napi_value obj,
-                   const std::function<bool(K key, V value)>& visit) {
+template<typename T, typename Visit>
+bool IterateArray(napi_env env, napi_value arr, Visit&& visit) {
+  return IterateArray<T>(env, arr, [](uint32_t) {},
+                         std::forward<Visit>(visit));
+}
+
+// Iterate the own enumerable string keys of |obj|, integer keys are converted
+// to strings.
+template<typename K, typename V, typename Visit>
+bool IterateObject(napi_env env, napi_value obj, Visit&& visit) {
   if (!IsType(env, obj, napi_object))
     return false;
   napi_value property_names;
-  if (napi_get_property_names(env, obj, &property_names) != napi_ok)
+  if (napi_get_all_property_names(
+          env, obj, napi_key_own_only,
+          static_cast<napi_key_filter>(napi_key_enumerable |
+                                       napi_key_skip_symbols),
+          napi_key_numbers_to_strings, &property_names) != napi_ok) {
     return false;
-  auto visit_arr = [&env, &obj, &visit](uint32_t i, napi_value key) {
-    std::optional<K> k = FromNodeTo<K>(env, key);
-    if (!k)
-      return false;
-    napi_value value;
-    if (napi_get_property(env, obj, key, &value) != napi_ok)
-      return false;
-    std::optional<V> v = FromNodeTo<V>(env, value);
-    if (!v)
-      return false;
-    return visit(std::move(*k), std::move(*v));
-  };
-  return IterateArray<napi_value>(env, property_names, visit_arr);
+  }
+  return IterateArray<napi_value>(
+      env, property_names, [&](uint32_t i, napi_value key) {
+        std::optional<K> k = FromNodeTo<K>(env, key);
+        if (!k)
+          return false;
+        napi_value value;
+        if (napi_get_property(env, obj, key, &value) != napi_ok)
+          return false;
+        std::optional<V> v = FromNodeTo<V>(env, value);
+        if (!v)
+          return false;
+        return visit(std::move(*k), std::move(*v));
+      });
 }
 
 }  // namespace ki
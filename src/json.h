@@ -0,0 +1,246 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#ifndef SRC_JSON_H_
+#define SRC_JSON_H_
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "src/method_handle.h"
+#include "src/std_types.h"
+
+namespace ki {
+
+// Wraps a value that is converted to JavaScript by writing it as a JSON string
+// and then parsing it with one JSON.parse call, which is much faster than
+// creating each node with N-API calls for large nested values:
+//   ki::AsJSON<std::vector<std::map<std::string, int>>> GetRecords() {
+//     return ki::AsJSON(ReadRecords());
+//   }
+// The result is the same with converting the value directly, except that NaN
+// and Infinity become null.
+template<typename T>
+struct AsJSON {
+  explicit AsJSON(T value) : value(std::move(value)) {}
+  T value;
+};
+
+namespace internal {
+
+// Writes C++ values as JSON, in the same layout with Type<T>::ToNode.
+template<typename T, typename Enable = void>
+struct JSONWriter {};
+
+inline void WriteJSONString(std::string* out, const char* str, size_t length) {
+  out->push_back('"');
+  size_t start = 0;
+  for (size_t i = 0; i < length; ++i) {
+    unsigned char c = str[i];
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    out->append(str + start, i - start);
+    start = i + 1;
+    switch (c) {
+      case '"': out->append("\\\""); break;
+      case '\\': out->append("\\\\"); break;
+      case '\b': out->append("\\b"); break;
+      case '\f': out->append("\\f"); break;
+      case '\n': out->append("\\n"); break;
+      case '\r': out->append("\\r"); break;
+      case '\t': out->append("\\t"); break;
+      default: {
+        char escaped[7];
+        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+        out->append(escaped, 6);
+      }
+    }
+  }
+  out->append(str + start, length - start);
+  out->push_back('"');
+}
+
+template<>
+struct JSONWriter<bool> {
+  static void Write(std::string* out, bool value) {
+    out->append(value ? "true" : "false");
+  }
+};
+
+template<typename T>
+struct JSONWriter<T, std::enable_if_t<std::is_arithmetic_v<T>>> {
+  static void Write(std::string* out, T value) {
+    char buffer[32];
+    std::to_chars_result result;
+    if constexpr (std::is_floating_point_v<T>) {
+      if (!std::isfinite(value)) {
+        out->append("null");
+        return;
+      }
+      // Floats are converted to double in ToNode.
+      result = std::to_chars(buffer, buffer + sizeof(buffer),
+                             static_cast<double>(value));
+    } else {
+      result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    }
+    out->append(buffer, result.ptr);
+  }
+};
+
+template<>
+struct JSONWriter<std::string> {
+  static void Write(std::string* out, const std::string& value) {
+    WriteJSONString(out, value.data(), value.size());
+  }
+};
+
+template<>
+struct JSONWriter<const char*> {
+  static void Write(std::string* out, const char* value) {
+    WriteJSONString(out, value, std::strlen(value));
+  }
+};
+
+template<typename T>
+struct JSONWriter<T, std::enable_if_t<std::is_same_v<T, std::nullptr_t> ||
+                                      std::is_same_v<T, std::monostate>>> {
+  static void Write(std::string* out, T) {
+    out->append("null");
+  }
+};
+
+template<typename T>
+struct JSONWriter<std::optional<T>> {
+  static void Write(std::string* out, const std::optional<T>& value) {
+    if (value)
+      JSONWriter<T>::Write(out, *value);
+    else
+      out->append("null");
+  }
+};
+
+template<typename T>
+struct JSONArrayWriter {
+  static void Write(std::string* out, const T& value) {
+    out->push_back('[');
+    bool first = true;
+    for (const auto& element : value) {
+      if (!first)
+        out->push_back(',');
+      first = false;
+      JSONWriter<typename T::value_type>::Write(out, element);
+    }
+    out->push_back(']');
+  }
+};
+
+template<typename T>
+struct JSONWriter<std::vector<T>> : JSONArrayWriter<std::vector<T>> {};
+
+template<typename T>
+struct JSONWriter<std::set<T>> : JSONArrayWriter<std::set<T>> {};
+
+// Writer for std::map/std::unordered_map.
+template<typename T>
+struct JSONWriter<T, std::enable_if_t<  // is map type
+                         std::is_same_v<typename T::value_type,
+                                        std::pair<const typename T::key_type,
+                                                  typename T::mapped_type>>>> {
+  using K = typename T::key_type;
+  using V = typename T::mapped_type;
+  static_assert(std::is_same_v<K, std::string> || std::is_integral_v<K>,
+                "Only string and integer keys can be written as JSON.");
+
+  static void Write(std::string* out, const T& value) {
+    out->push_back('{');
+    bool first = true;
+    for (const auto& it : value) {
+      if (!first)
+        out->push_back(',');
+      first = false;
+      if constexpr (std::is_same_v<K, std::string>) {
+        JSONWriter<K>::Write(out, it.first);
+      } else {
+        out->push_back('"');
+        JSONWriter<K>::Write(out, it.first);
+        out->push_back('"');
+      }
+      out->push_back(':');
+      JSONWriter<V>::Write(out, it.second);
+    }
+    out->push_back('}');
+  }
+};
+
+template<typename... ArgTypes>
+struct JSONWriter<std::tuple<ArgTypes...>> {
+  using V = std::tuple<ArgTypes...>;
+  static void Write(std::string* out, const V& value) {
+    out->push_back('[');
+    if constexpr (sizeof...(ArgTypes) > 0)
+      WriteElements(out, value);
+    out->push_back(']');
+  }
+
+ private:
+  template<std::size_t I = 0>
+  static void WriteElements(std::string* out, const V& tup) {
+    if constexpr (I > 0)
+      out->push_back(',');
+    JSONWriter<std::tuple_element_t<I, V>>::Write(out, std::get<I>(tup));
+    if constexpr (I + 1 < sizeof...(ArgTypes))
+      WriteElements<I + 1>(out, tup);
+  }
+};
+
+template<typename T1, typename T2>
+struct JSONWriter<std::pair<T1, T2>> {
+  static void Write(std::string* out, const std::pair<T1, T2>& value) {
+    out->push_back('[');
+    JSONWriter<T1>::Write(out, value.first);
+    out->push_back(',');
+    JSONWriter<T2>::Write(out, value.second);
+    out->push_back(']');
+  }
+};
+
+template<typename... ArgTypes>
+struct JSONWriter<std::variant<ArgTypes...>> {
+  static void Write(std::string* out, const std::variant<ArgTypes...>& value) {
+    std::visit([out](const auto& arg) {
+      JSONWriter<std::decay_t<decltype(arg)>>::Write(out, arg);
+    }, value);
+  }
+};
+
+}  // namespace internal
+
+template<typename T>
+struct Type<AsJSON<T>> {
+  static constexpr const char* name = Type<T>::name;
+  static napi_status ToNode(napi_env env,
+                            const AsJSON<T>& value,
+                            napi_value* result) {
+    std::string json;
+    internal::JSONWriter<T>::Write(&json, value.value);
+    napi_value str;
+    napi_status s = napi_create_string_utf8(env, json.data(), json.size(),
+                                            &str);
+    if (s != napi_ok)
+      return s;
+    napi_value parsed =
+        BuiltinFunction<internal::kJSONKey, internal::kParseKey>(env).Call(
+            Undefined(env), str);
+    if (!parsed)
+      return napi_pending_exception;
+    *result = parsed;
+    return napi_ok;
+  }
+};
+
+}  // namespace ki
+
+#endif  // SRC_JSON_H_
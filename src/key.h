@@ -0,0 +1,119 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#ifndef SRC_KEY_H_
+#define SRC_KEY_H_
+
+#include <atomic>
+
+#include "src/types.h"
+
+namespace ki {
+
+namespace internal {
+
+// Each Key gets a process-wide index at first use, which is used to index the
+// per-env caches of keys.
+inline size_t NextKeyIndex() {
+  static std::atomic<size_t> next_index{0};
+  return next_index++;
+}
+
+// Create a string optimized for being used as property key. The internalized
+// property keys of Node-API are only declared for NAPI_EXPERIMENTAL builds,
+// other builds create plain strings which are cached per env.
+inline napi_status CreatePropertyKey(napi_env env, const char* str,
+                                     napi_value* result) {
+#if defined(NODE_API_EXPERIMENTAL_HAS_PROPERTY_KEYS)
+  return node_api_create_property_key_utf8(env, str, NAPI_AUTO_LENGTH, result);
+#else
+  return napi_create_string_utf8(env, str, NAPI_AUTO_LENGTH, result);
+#endif
+}
+
+// Return the cached key and symbol of |env|, they are defined in
+// instance_data.h.
+inline napi_value GetCachedKey(napi_env env, size_t index, const char* str);
+inline napi_value GetCachedSymbolFor(napi_env env, const char* str);
+
+}  // namespace internal
+
+// A property key known at compile time, the JS string is created once for
+// each env and then reused:
+//   constexpr char kWidth[] = "width";
+//   ki::Get(env, object, ki::Key<kWidth>(), &width);
+template<const char* str>
+struct Key {
+  static size_t Index() {
+    static const size_t index = internal::NextKeyIndex();
+    return index;
+  }
+};
+
+template<const char* str>
+struct Type<Key<str>> {
+  static constexpr const char* name = "String";
+  static inline napi_status ToNode(napi_env env,
+                                   Key<str>,
+                                   napi_value* result) {
+    *result = internal::GetCachedKey(env, Key<str>::Index(), str);
+    return *result ? napi_ok : napi_generic_failure;
+  }
+};
+
+namespace internal {
+
+// Keys used by kizunapi.
+inline constexpr char kConstructorKey[] = "constructor";
+inline constexpr char kCreateKey[] = "create";
+inline constexpr char kDeleteKey[] = "delete";
+inline constexpr char kGetKey[] = "get";
+inline constexpr char kHasKey[] = "has";
+inline constexpr char kJSONKey[] = "JSON";
+inline constexpr char kMapKey[] = "Map";
+inline constexpr char kNameKey[] = "name";
+inline constexpr char kObjectKey[] = "Object";
+inline constexpr char kParseKey[] = "parse";
+inline constexpr char kPrototypeKey[] = "prototype";
+inline constexpr char kSetKey[] = "set";
+inline constexpr char kSetPrototypeOfKey[] = "setPrototypeOf";
+inline constexpr char kWeakMapKey[] = "WeakMap";
+
+}  // namespace internal
+
+// Optimized helper for creating symbols.
+struct SymbolHolder {
+  bool symbol_for;
+  const char* str;
+};
+
+inline SymbolHolder Symbol(const char* str) {
+  return {false, str};
+}
+
+// The symbols from the global registry are cached for each env.
+inline SymbolHolder SymbolFor(const char* str) {
+  return {true, str};
+}
+
+template<>
+struct Type<SymbolHolder> {
+  static constexpr const char* name = "Symbol";
+  static inline napi_status ToNode(napi_env env,
+                                   SymbolHolder value,
+                                   napi_value* result) {
+    if (value.symbol_for) {
+      *result = internal::GetCachedSymbolFor(env, value.str);
+      return *result ? napi_ok : napi_generic_failure;
+    }
+    napi_value description;
+    napi_status s = Type<const char*>::ToNode(env, value.str, &description);
+    if (s != napi_ok)
+      return s;
+    return napi_create_symbol(env, description, result);
+  }
+};
+
+}  // namespace ki
+
+#endif  // SRC_KEY_H_
@@ -4,38 +4,30 @@
 #ifndef SRC_MAP_H_
 #define SRC_MAP_H_
 
+#include "src/method_handle.h"
 #include "src/napi_util.h"
-#include "src/local.h"
 
 namespace ki {
 
-inline napi_value NewInstanceFromBuiltinType(napi_env env, const char* type) {
-  napi_value global = nullptr;
-  napi_get_global(env, &global);
-  napi_value constructor = nullptr;
-  napi_get_named_property(env, global, type, &constructor);
-  napi_value instance = nullptr;
-  napi_new_instance(env, constructor, 0, nullptr, &instance);
-  return instance;
-}
+class InstanceData;
 
+// Wrapper of Map, the methods call the builtin Map.prototype methods directly
+// for Map instances, and call the methods of the object for Map-like objects.
 class Map : public Local {
  public:
   Map() = default;
   Map(napi_env env, napi_value value) : Local(env, value) {}
-  explicit Map(napi_env env) : Map(env, "Map") {}
+  explicit Map(napi_env env)
+      : Map(env, NewInstance<internal::kMapKey>(env), false, true) {}
 
   template<typename K, typename V>
   void Set(const K& key, const V& value) {
-    CallMethod(Env(), Value(),
-               "set",
-               ToNodeValue(Env(), key),
-               ToNodeValue(Env(), value));
+    CallMapMethod<internal::kSetKey>(key, value);
   }
 
   template<typename K, typename V>
   bool Get(const K& key, V* out) const {
-    napi_value ret = CallMethod(Env(), Value(), "get", ToNodeValue(Env(), key));
+    napi_value ret = CallMapMethod<internal::kGetKey>(key);
     if (!ret || IsType(Env(), ret, napi_undefined))
       return false;
     std::optional<V> result = FromNodeTo<V>(Env(), ret);
@@ -48,15 +40,12 @@ class Map : public Local {
   template<typename K>
   bool Has(const K& key) const {
     return FromNodeTo<bool>(
-        Env(),
-        CallMethod(Env(), Value(),
-                   "has",
-                   ToNodeValue(Env(), key))).value_or(false);
+        Env(), CallMapMethod<internal::kHasKey>(key)).value_or(false);
   }
 
   template<typename K>
   void Delete(const K& key) {
-    CallMethod(Env(), Value(), "delete", ToNodeValue(Env(), key));
+    CallMapMethod<internal::kDeleteKey>(key);
   }
 
   template<typename K>
@@ -70,13 +59,56 @@ class Map : public Local {
   }
 
  protected:
-  explicit Map(napi_env env, const char* type)
-      : Local(env, NewInstanceFromBuiltinType(env, type)) {}
+  friend class InstanceData;
+
+  Map(napi_env env, napi_value value, bool weak, bool is_builtin = false)
+      : Local(env, value), weak_(weak), is_builtin_(is_builtin ? 1 : -1) {}
+
+  template<const char* type>
+  static napi_value NewInstance(napi_env env) {
+    napi_value instance = nullptr;
+    napi_new_instance(env, BuiltinConstructor<type>(env), 0, nullptr,
+                      &instance);
+    return instance;
+  }
+
+ private:
+  template<const char* name, typename... ArgTypes>
+  napi_value CallMapMethod(const ArgTypes&... args) const {
+    if (!IsBuiltin())
+      return CallMethod(Env(), Value(), Key<name>(), args...);
+    MethodHandle method = weak_ ?
+        BuiltinMethod<internal::kWeakMapKey, name>(Env()) :
+        BuiltinMethod<internal::kMapKey, name>(Env());
+    return method.Call(Value(), args...);
+  }
+
+  // Whether the object is an instance of builtin Map/WeakMap, checked once so
+  // exceptions thrown by the methods are never swallowed by a fallback.
+  bool IsBuiltin() const {
+    if (is_builtin_ < 0) {
+      napi_value constructor = weak_ ?
+          BuiltinConstructor<internal::kWeakMapKey>(Env()) :
+          BuiltinConstructor<internal::kMapKey>(Env());
+      bool result = false;
+      is_builtin_ = constructor &&
+                    napi_instanceof(Env(), Value(), constructor,
+                                    &result) == napi_ok &&
+                    result;
+    }
+    return is_builtin_;
+  }
+
+  bool weak_ = false;
+  mutable int8_t is_builtin_ = -1;
 };
 
 class WeakMap : public Map {
  public:
-  explicit WeakMap(napi_env env) : Map(env, "WeakMap") {}
+  WeakMap() = default;
+  WeakMap(napi_env env, napi_value value) : Map(env, value, true) {}
+  explicit WeakMap(napi_env env)
+      : Map(env, NewInstance<internal::kWeakMapKey>(env), true, true) {}
 };
 
 }  // namespace ki
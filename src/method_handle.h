@@ -0,0 +1,99 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#ifndef SRC_METHOD_HANDLE_H_
+#define SRC_METHOD_HANDLE_H_
+
+#include "src/dict.h"
+#include "src/local.h"
+
+namespace ki {
+
+// A function resolved once, which can then be called with different |this|
+// without looking up the method by name:
+//   ki::MethodHandle push(env, array, "push");
+//   push.Call(array, 89);
+//   push.Call(array, 64);
+class MethodHandle : public Local {
+ public:
+  MethodHandle() = default;
+  MethodHandle(napi_env env, napi_value func) : Local(env, func) {}
+
+  template<typename Name>
+  MethodHandle(napi_env env, napi_value object, Name&& name)
+      : Local(env, Resolve(env, object, std::forward<Name>(name))) {}
+
+  // Invoke the method with |object| as this, returns nullptr on failure.
+  template<typename... ArgTypes>
+  napi_value Call(napi_value object, ArgTypes&&... args) const {
+    if (!Value())
+      return nullptr;
+    napi_value argv[] = {ToNodeValue(Env(), std::forward<ArgTypes>(args))...};
+    napi_value ret = nullptr;
+    napi_call_function(Env(), object, Value(), sizeof...(args),
+                       sizeof...(args) == 0 ? nullptr : argv, &ret);
+    return ret;
+  }
+
+ private:
+  template<typename Name>
+  static napi_value Resolve(napi_env env, napi_value object, Name&& name) {
+    napi_value func = nullptr;
+    if (!Get(env, object, std::forward<Name>(name), &func) ||
+        !IsType(env, func, napi_function)) {
+      return nullptr;
+    }
+    return func;
+  }
+};
+
+namespace internal {
+
+// Each builtin gets a process-wide index at first use.
+inline size_t NextBuiltinIndex() {
+  static std::atomic<size_t> next_index{0};
+  return next_index++;
+}
+
+// Return the cached builtin class or its function, it is defined in
+// instance_data.h.
+inline napi_value GetCachedBuiltin(napi_env env, size_t index,
+                                   const char* type, const char* name,
+                                   bool on_prototype);
+
+}  // namespace internal
+
+// The builtins are looked up once for each env, so they are not affected by
+// later changes to the global object:
+//   constexpr char kMap[] = "Map";
+//   constexpr char kGet[] = "get";
+//   napi_value map = ki::BuiltinConstructor<kMap>(env);
+//   ki::BuiltinMethod<kMap, kGet>(env).Call(map_instance, key);
+
+// Return the constructor of a builtin class.
+template<const char* type>
+inline napi_value BuiltinConstructor(napi_env env) {
+  static const size_t index = internal::NextBuiltinIndex();
+  return internal::GetCachedBuiltin(env, index, type, nullptr, false);
+}
+
+// Return the method of a builtin class's prototype.
+template<const char* type, const char* name>
+inline MethodHandle BuiltinMethod(napi_env env) {
+  static const size_t index = internal::NextBuiltinIndex();
+  return MethodHandle(
+      env, internal::GetCachedBuiltin(env, index, type, name, true));
+}
+
+// Return the static function of a builtin class or namespace, like
+// Object.create and JSON.parse.
+template<const char* type, const char* name>
+inline MethodHandle BuiltinFunction(napi_env env) {
+  static const size_t index = internal::NextBuiltinIndex();
+  return MethodHandle(
+      env, internal::GetCachedBuiltin(env, index, type, name, false));
+}
+
+}  // namespace ki
+
+#endif  // SRC_METHOD_HANDLE_H_
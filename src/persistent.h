@@ -28,7 +28,7 @@ class Persistent {
     *this = other;
   }
 
-  Persistent(Persistent&& other) {
+  Persistent(Persistent&& other) noexcept {
     *this = std::move(other);
   }
 
@@ -53,7 +53,7 @@ class Persistent {
     return *this;
   }
 
-  Persistent& operator=(Persistent&& other) {
+  Persistent& operator=(Persistent&& other) noexcept {
     if (this != &other) {
       Destroy();
       env_ = other.env_;
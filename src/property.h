@@ -6,6 +6,7 @@
 
 #include "src/attached_table.h"
 #include "src/property_internal.h"
+#include "src/wrap_data.h"
 
 namespace ki {
 
@@ -35,6 +36,9 @@ inline auto Setter(MemberFunctionHolder<T> func) {
 struct Property {
   using Type = internal::CallbackType;
 
+  // The cached values of wrappers are referenced by their native data, so a
+  // cached value that references its wrapper, other than the wrapper itself,
+  // keeps the wrapper alive.
   enum class CacheMode {
     NoCache,
     Getter,
@@ -73,6 +77,12 @@ struct Property {
   napi_value value = nullptr;
   CacheMode cache_mode = CacheMode::NoCache;
 
+  // For member object pointers, the direct callbacks which read the pointer
+  // from |member_pointer| are used when the property is not cached.
+  napi_callback member_getter = nullptr;
+  napi_callback member_setter = nullptr;
+  std::aligned_storage_t<2 * sizeof(void*)> member_pointer;
+
   // We don't accept napi_static so use it as null.
   napi_property_attributes attributes = napi_static;
 
@@ -99,17 +109,24 @@ struct Property {
   template<typename T>
   typename std::enable_if<std::is_member_object_pointer<T>::value>::type
   SetProperty(T ptr) {
+    static_assert(sizeof(T) <= sizeof(member_pointer),
+                  "Unsupported member object pointer.");
     SetProperty(Getter(ptr), Setter(ptr));
+    new (&member_pointer) T(ptr);
+    member_getter = &internal::MemberObjectCallbacks<T>::Get;
+    member_setter = &internal::MemberObjectCallbacks<T>::Set;
   }
 
   template<typename Sig>
   void SetProperty(internal::PropertyMethodHolder<Sig, Type::Getter>&& holder) {
     getter = CreateNodeCallbackWithHolder(std::move(holder));
+    member_getter = member_setter = nullptr;
   }
 
   template<typename Sig>
   void SetProperty(internal::PropertyMethodHolder<Sig, Type::Setter>&& holder) {
     setter = CreateNodeCallbackWithHolder(std::move(holder));
+    member_getter = member_setter = nullptr;
   }
 
   template<typename T, typename... ArgTypes>
@@ -121,36 +138,86 @@ struct Property {
 
 namespace internal {
 
-// Invoke a property method.
+// Store the cached values of a property. The values of wrappers are kept in
+// the native slots of their WrapData, and plain objects fall back to
+// AttachedTable.
+class PropertyCache {
+ public:
+  PropertyCache(napi_env env, napi_value object, Property* property)
+      : env_(env),
+        object_(object),
+        property_(property),
+        wrap_data_(GetWrapData(env, object)) {}
+
+  bool Get(napi_value* result) {
+    if (!wrap_data_)
+      return AttachedTable(env_, object_).Get(property_->name, result);
+    for (const PropertySlot& slot : wrap_data_->property_slots) {
+      if (slot.key() == property_)
+        return slot.Get(env_, object_, result) == napi_ok;
+    }
+    return false;
+  }
+
+  void Set(napi_value value) {
+    if (!wrap_data_) {
+      AttachedTable(env_, object_).Set(property_->name, value);
+      return;
+    }
+    for (PropertySlot& slot : wrap_data_->property_slots) {
+      if (slot.key() == property_) {
+        slot.Set(env_, object_, value);
+        return;
+      }
+    }
+    wrap_data_->property_slots.emplace_back(property_);
+    if (wrap_data_->property_slots.back().Set(env_, object_, value) != napi_ok)
+      wrap_data_->property_slots.pop_back();
+  }
+
+ private:
+  napi_env env_;
+  napi_value object_;
+  Property* property_;
+  WrapData* wrap_data_;
+};
+
+// Invoke a property method, the cached values are read before creating
+// Arguments so a cache hit only resolves the wrapper.
 template<CallbackType type>
 napi_value InvokePropertyMethod(napi_env env, napi_callback_info info) {
-  Arguments args(env, info);
-  Property* property = static_cast<Property*>(args.Data());
+  size_t argc = type == CallbackType::Setter ? 1 : 0;
+  napi_value value = nullptr;
+  napi_value object;
+  void* data;
+  if (napi_get_cb_info(env, info, &argc, &value, &object, &data) != napi_ok)
+    return nullptr;
+  Property* property = static_cast<Property*>(data);
   napi_value result;
   if (type == CallbackType::Getter) {
-    AttachedTable table;
+    std::optional<PropertyCache> cache;
     if (property->cache_mode == Property::CacheMode::Getter ||
         property->cache_mode == Property::CacheMode::GetterAndSetter) {
-      table = AttachedTable(args);
-      if (table.Get(property->name, &result))
+      cache.emplace(env, object, property);
+      if (cache->Get(&result))
         return result;
     }
     result = property->getter(env, info);
-    if (property->cache_mode == Property::CacheMode::Getter ||
-        property->cache_mode == Property::CacheMode::GetterAndSetter)
-      table.Set(property->name, result);
+    if (cache && result)
+      cache->Set(result);
   } else if (type == CallbackType::Setter) {
     result = property->setter(env, info);
-    if (args.Length() > 0 &&
+    if (argc > 0 &&
         property->cache_mode == Property::CacheMode::GetterAndSetter)
-      AttachedTable(args).Set(property->name, args[0]);
+      PropertyCache(env, object, property).Set(value);
   }
   return result;
 }
 
-// Convert a property to descriptor.
+// Convert a property to descriptor, the descriptor refers to the |holder|
+// which must be kept alive as long as the property exists.
 inline napi_property_descriptor PropertyToDescriptor(
-    napi_env env, napi_value object, Property prop) {
+    napi_env env, Property prop, std::unique_ptr<Property>* holder_out) {
   // Initialize members to 0.
   napi_property_descriptor descriptor = {};
   // Translate Property to napi_property_descriptor.
@@ -161,9 +228,24 @@ inline napi_property_descriptor PropertyToDescriptor(
     descriptor.getter = InvokePropertyMethod<CallbackType::Getter>;
   if (prop.setter)
     descriptor.setter = InvokePropertyMethod<CallbackType::Setter>;
-  // Attach the property holder to object.
   auto holder = std::make_unique<Property>(std::move(prop));
   descriptor.data = holder.get();
+  if (holder->member_getter &&
+      holder->cache_mode == Property::CacheMode::NoCache) {
+    descriptor.getter = holder->member_getter;
+    descriptor.setter = holder->member_setter;
+    descriptor.data = &holder->member_pointer;
+  }
+  *holder_out = std::move(holder);
+  return descriptor;
+}
+
+// Convert a property to descriptor and attach the property holder to object.
+inline napi_property_descriptor PropertyToDescriptor(
+    napi_env env, napi_value object, Property prop) {
+  std::unique_ptr<Property> holder;
+  napi_property_descriptor descriptor =
+      PropertyToDescriptor(env, std::move(prop), &holder);
   napi_status s = AddToFinalizer(env, object, std::move(holder));
   if (s != napi_ok)
     return {};
@@ -185,6 +267,59 @@ inline napi_status DefineProperties(napi_env env, napi_value object,
   return napi_define_properties(env, object, desps.size(), &desps.front());
 }
 
+// Defines a JS property whose getter and setter are known at compile time,
+// which generates plain napi_callbacks without allocating holders:
+//   constexpr char kWidth[] = "width";
+//   ki::Prop<kWidth, &Rect::width>
+// The getter and setter can be member object pointers, methods or functions.
+// If only a member object pointer is passed it is used as both getter and
+// setter, otherwise the property is read-only unless a setter is passed. The
+// |flags| are passed to the getter and setter.
+template<const char* name,
+         auto getter,
+         auto setter = internal::DefaultSetter::kValue,
+         int flags = 0>
+struct Prop {
+  static constexpr auto GetSetter() {
+    if constexpr (!std::is_same_v<decltype(setter), internal::DefaultSetter>)
+      return setter;
+    else if constexpr (std::is_member_object_pointer_v<decltype(getter)>)
+      return getter;
+    else
+      return nullptr;
+  }
+
+  static napi_property_descriptor Descriptor() {
+    using Type = internal::CallbackType;
+    napi_property_descriptor descriptor = {};
+    descriptor.utf8name = name;
+    descriptor.getter =
+        internal::PropertyCallback<getter, Type::Getter, flags>::value;
+    descriptor.setter =
+        internal::PropertyCallback<GetSetter(), Type::Setter, flags>::value;
+    // Same with the default attributes of Property.
+    if (descriptor.setter) {
+      descriptor.attributes = static_cast<napi_property_attributes>(
+          napi_writable | napi_enumerable);
+    } else {
+      descriptor.attributes = napi_enumerable;
+    }
+    return descriptor;
+  }
+};
+
+// A list of Prop, which are defined in one napi_define_properties call.
+template<typename... Props>
+struct Properties {};
+
+template<typename... Props>
+inline napi_status DefineProperties(napi_env env, napi_value object,
+                                    Properties<Props...>) {
+  static_assert(sizeof...(Props) > 0, "No properties to define.");
+  const napi_property_descriptor descriptors[] = {Props::Descriptor()...};
+  return napi_define_properties(env, object, sizeof...(Props), descriptors);
+}
+
 }  // namespace ki
 
 #endif  // SRC_PROPERTY_H_
@@ -69,6 +69,137 @@ struct PropertyMethodHolderFactory<T, CallbackType::Setter,
   }
 };
 
+// Plain functions for accessing a member object, so getters and setters of
+// member object pointers can be used with FunctionInvoker.
+template<auto member>
+struct MemberAccessor {
+  using ClassType =
+      typename ExtractMemberPointer<decltype(member)>::ClassType;
+  using MemberType =
+      typename ExtractMemberPointer<decltype(member)>::MemberType;
+  static MemberType Get(ClassType* ptr) {
+    return ptr->*member;
+  }
+  static void Set(ClassType* ptr, MemberType value) {
+    ptr->*member = std::move(value);
+  }
+};
+
+// Give a compile time constant an address.
+template<auto value>
+struct ConstantHolder {
+  static constexpr decltype(value) kValue = value;
+};
+
+// Getter and setter callbacks of member object pointers, which read and write
+// the member of |this| directly without going through Arguments and Invoker.
+// The |member| is either known at compile time or stored in callback data.
+template<typename T, const T* member = nullptr>
+struct MemberObjectCallbacks {
+  using ClassType = typename ExtractMemberPointer<T>::ClassType;
+  using MemberType = typename ExtractMemberPointer<T>::MemberType;
+  using LocalType = typename CallbackParamTraits<MemberType>::LocalType;
+
+  static napi_value Get(napi_env env, napi_callback_info info) {
+    napi_value self;
+    void* data;
+    size_t argc = 0;
+    if (napi_get_cb_info(env, info, &argc, nullptr, &self, &data) != napi_ok)
+      return nullptr;
+    ClassType* ptr = UnwrapThis(env, self);
+    if (!ptr)
+      return nullptr;
+    return ToNodeValue(env, ptr->*GetMember(data));
+  }
+
+  static napi_value Set(napi_env env, napi_callback_info info) {
+    napi_value self, value;
+    void* data;
+    size_t argc = 1;
+    if (napi_get_cb_info(env, info, &argc, &value, &self, &data) != napi_ok)
+      return nullptr;
+    ClassType* ptr = UnwrapThis(env, self);
+    if (!ptr)
+      return nullptr;
+    if (argc < 1) {
+      ThrowTypeError(env, "Insufficient number of arguments.");
+      return nullptr;
+    }
+    std::optional<LocalType> result = FromNodeTo<LocalType>(env, value);
+    if (!result) {
+      ThrowTypeError(env, "Error processing argument at index 0, "
+                          "conversion failure from ",
+                          NodeTypeToString(env, value), " to ",
+                          Type<LocalType>::name, ".");
+      return nullptr;
+    }
+    ptr->*GetMember(data) = std::move(*result);
+    return nullptr;
+  }
+
+ private:
+  static inline T GetMember(void* data) {
+    if constexpr (member != nullptr)
+      return *member;
+    else
+      return *static_cast<T*>(data);
+  }
+
+  static inline ClassType* UnwrapThis(napi_env env, napi_value self) {
+    std::optional<ClassType*> ptr = FromNodeTo<ClassType*>(env, self);
+    if (!ptr) {
+      ThrowTypeError(env, "Error converting \"this\" to ",
+                          Type<ClassType*>::name, ".");
+      return nullptr;
+    }
+    return *ptr;
+  }
+};
+
+// Return the napi_callback of a getter or setter known at compile time.
+template<auto func, CallbackType type, int flags, typename Enable = void>
+struct PropertyCallback {
+  static constexpr napi_callback value = &FunctionInvoker<func, flags>::Invoke;
+};
+
+template<auto func, CallbackType type, int flags>
+struct PropertyCallback<func, type, flags,
+                        std::enable_if_t<
+                            std::is_null_pointer_v<decltype(func)>>> {
+  static constexpr napi_callback value = nullptr;
+};
+
+// Member object pointers use the direct callbacks, unless there are flags
+// which need the conversions of Invoker.
+template<auto member, int flags>
+struct PropertyCallback<member, CallbackType::Getter, flags,
+                        std::enable_if_t<std::is_member_object_pointer_v<
+                            decltype(member)>>> {
+  using Callbacks = MemberObjectCallbacks<decltype(member),
+                                          &ConstantHolder<member>::kValue>;
+  static constexpr napi_callback value =
+      flags == 0 ? &Callbacks::Get
+                 : &FunctionInvoker<&MemberAccessor<member>::Get,
+                                    HolderIsFirstArgument | flags>::Invoke;
+};
+
+template<auto member, int flags>
+struct PropertyCallback<member, CallbackType::Setter, flags,
+                        std::enable_if_t<std::is_member_object_pointer_v<
+                            decltype(member)>>> {
+  using Callbacks = MemberObjectCallbacks<decltype(member),
+                                          &ConstantHolder<member>::kValue>;
+  static constexpr napi_callback value =
+      flags == 0 ? &Callbacks::Set
+                 : &FunctionInvoker<&MemberAccessor<member>::Set,
+                                    HolderIsFirstArgument | flags>::Invoke;
+};
+
+// Used as the default setter of Prop.
+enum class DefaultSetter {
+  kValue,
+};
+
 }  // namespace internal
 
 }  // namespace ki
@@ -37,16 +37,23 @@ napi_status ManagePointerInJSWrapper(napi_env env, T* ptr, napi_value* result) {
   napi_value object = internal::CreateInstance<T>(env);
   if (!object)
     return napi_generic_failure;
+  napi_status s = internal::TagObject(env, object);
+  if (s != napi_ok)
+    return s;
   // Wrap the |ptr| into JS object.
   auto* data = internal::Wrap<T>::Do(ptr);
   using DataType = decltype(data);
+  internal::WrapData* wrap_data = internal::NewWrapData<T>(data);
   napi_ref ref;
-  napi_status s = napi_wrap(env, object, data,
-                            [](napi_env env, void* data, void* ptr) {
+  s = napi_wrap(env, object, wrap_data,
+                [](napi_env env, void* data, void* ptr) {
     InstanceData::Get(env)->DeleteWrapper<T>(ptr);
-    internal::Finalize<T>::Do(static_cast<DataType>(data));
+    auto* wrap_data = static_cast<internal::WrapData*>(data);
+    internal::Finalize<T>::Do(static_cast<DataType>(wrap_data->data));
+    delete wrap_data;
   }, ptr, &ref);
   if (s != napi_ok) {
+    delete wrap_data;
     internal::Finalize<T>::Do(data);
     return s;
   }
@@ -62,6 +69,7 @@ struct Type<T*, std::enable_if_t<!std::is_const_v<T> &&
                                  std::is_class_v<T> &&
                                  std::is_class_v<Type<T>>>> {
   static constexpr const char* name = Type<T>::name;
+  static constexpr uint32_t kinds = kObjectKind;
 
  private:
   // Mark the direct ToNode/FromNode methods as private to force users to use
@@ -83,10 +91,8 @@ struct Type<T*, std::enable_if_t<!std::is_const_v<T> &&
   }
 
   static inline std::optional<T*> FromNode(napi_env env, napi_value value) {
-    void* result;
-    if (napi_unwrap(env, value, &result) != napi_ok)
-      return std::nullopt;
-    if (!internal::IsInstanceOf<T>(env, value))
+    void* result = internal::UnwrapInstanceOf<T>(env, value);
+    if (!result)
       return std::nullopt;
     T* ptr = internal::Unwrap<T>::Do(result);
     if (!ptr)
@@ -111,6 +117,7 @@ struct Type<T*, std::enable_if_t<std::is_const_v<T> &&
 // implemented via copying.
 template<typename T>
 struct AllowPassByValue {
+  static constexpr uint32_t kinds = kObjectKind;
   static inline napi_status ToNode(napi_env env, T value, napi_value* result) {
     return ManagePointerInJSWrapper(env, new T(std::move(value)), result);
   }
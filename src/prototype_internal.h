@@ -4,8 +4,15 @@
 #ifndef SRC_PROTOTYPE_INTERNAL_H_
 #define SRC_PROTOTYPE_INTERNAL_H_
 
-#include "src/property.h"
+#include <array>
+#include <atomic>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "src/class_builder.h"
 #include "src/instance_data.h"
+#include "src/wrap_data.h"
 
 namespace ki {
 
@@ -19,25 +26,9 @@ inline constexpr bool can_pass_by_value_v =
 
 namespace internal {
 
-// Return a key used to indicate whether the constructor should be called.
-inline void* GetConstructorKey() {
-  static int key = 0x8964;
-  return &key;
-}
-
-// Check if we should skip calling native constructor.
-inline bool IsCalledFromConverter(const Arguments& args) {
-  // Return if first arg is external.
-  void* key;
-  return args.Length() == 1 &&
-         napi_get_value_external(args.Env(), args[0], &key) == napi_ok &&
-         key == GetConstructorKey();
-}
-
 // The default constructor.
 inline napi_value DummyConstructor(napi_env env, napi_callback_info info) {
-  if (!IsCalledFromConverter(Arguments(env, info)))
-    ThrowError(env, "There is no constructor defined.");
+  ThrowError(env, "There is no constructor defined.");
   return nullptr;
 }
 
@@ -157,60 +148,171 @@ struct Destruct<T, typename std::enable_if<is_function_pointer<
   }
 };
 
-// Receive property list from type and define its prototype.
+// Each class gets a process-wide index at first use, which is used to index
+// the per-env constructors.
+inline size_t NextTypeIndex() {
+  static std::atomic<size_t> next_index{0};
+  return next_index++;
+}
+
+template<typename T>
+inline size_t TypeIndex() {
+  static const size_t index = NextTypeIndex();
+  return index;
+}
+
+// The identity of a class, whose address is unique for each class.
+template<typename T>
+struct ClassId {
+  static constexpr char id = 0;
+};
+
+// The chain of classes from the root class of T to T itself.
+template<typename T, typename Enable = void>
+struct ClassChain {
+  static constexpr size_t depth = 0;
+  static constexpr std::array<const void*, 1> ids = {&ClassId<T>::id};
+};
+
+template<size_t size>
+constexpr std::array<const void*, size + 1> AppendClassId(
+    const std::array<const void*, size>& ids, const void* id) {
+  std::array<const void*, size + 1> result = {};
+  for (size_t i = 0; i < size; ++i)
+    result[i] = ids[i];
+  result[size] = id;
+  return result;
+}
+
+template<typename T>
+struct ClassChain<T, typename std::enable_if<std::is_class<
+                         typename Type<T>::Base>::value>::type> {
+  using Base = typename Type<T>::Base;
+  static constexpr size_t depth = ClassChain<Base>::depth + 1;
+  static constexpr std::array<const void*, depth + 1> ids =
+      AppendClassId(ClassChain<Base>::ids, &ClassId<T>::id);
+};
+
+template<typename T>
+inline WrapData* NewWrapData(void* data) {
+  return new WrapData{ClassChain<T>::ids.data(), ClassChain<T>::depth, data};
+}
+
+// Return the wrapped data if JS |object| is an instance of |T|, unlike
+// instanceof the result can not be changed by modifying the prototype chain in
+// JS. It costs one tag check and one unwrap regardless of the hierarchy.
+template<typename T>
+void* UnwrapInstanceOf(napi_env env, napi_value object) {
+  WrapData* wrap_data = GetWrapData(env, object);
+  if (!wrap_data)
+    return nullptr;
+  constexpr size_t depth = ClassChain<T>::depth;
+  if (wrap_data->depth < depth ||
+      wrap_data->ids[depth] != &ClassId<T>::id) {
+    return nullptr;
+  }
+  return wrap_data->data;
+}
+
+// Detect which form of Type<T>::Define is provided, with call expressions so
+// overloaded and template Define functions are matched too.
+template<typename T, typename = void>
+struct HasDefineMember : std::false_type {};
+
+template<typename T>
+struct HasDefineMember<T, std::void_t<decltype(&Type<T>::Define)>>
+    : std::true_type {};
+
+template<typename T, typename = void>
+struct HasPrototypeDefine : std::false_type {};
+
+template<typename T>
+struct HasPrototypeDefine<T, std::void_t<decltype(Type<T>::Define(
+                                 std::declval<napi_env>(),
+                                 std::declval<napi_value>(),
+                                 std::declval<napi_value>()))>>
+    : std::true_type {};
+
+template<typename T, typename = void>
+struct HasBuilderDefine : std::false_type {};
+
+template<typename T>
+struct HasBuilderDefine<T, std::void_t<decltype(Type<T>::Define(
+                               std::declval<ClassBuilder*>()))>>
+    : std::true_type {};
+
+// Receive property list from type and define its prototype. The members
+// added to ClassBuilder are defined together with the class, while the
+// Define(env, constructor, prototype) form is called after the class is
+// created.
 template<typename T, typename Enable = void>
 struct Prototype {
+  static_assert(!HasDefineMember<T>::value,
+                "Type<T>::Define must take (napi_env, napi_value, napi_value) "
+                "or (ki::ClassBuilder*).");
+  static inline void Build(ClassBuilder* builder) {}
   static inline bool Define(napi_env env, napi_value constructor) {
     return true;
   }
 };
 
 template<typename T>
-struct Prototype<T, typename std::enable_if<is_function_pointer<
-                        decltype(&Type<T>::Define)>::value>::type> {
+struct Prototype<T, std::enable_if_t<HasPrototypeDefine<T>::value>> {
+  static_assert(!HasBuilderDefine<T>::value,
+                "Type<T>::Define can not take both forms.");
+  static inline void Build(ClassBuilder* builder) {}
   static inline bool Define(napi_env env, napi_value constructor) {
     napi_value prototype;
-    if (!Get(env, constructor, "prototype", &prototype))
+    if (!Get(env, constructor, Key<kPrototypeKey>(), &prototype))
       return false;
     Type<T>::Define(env, constructor, prototype);
     return true;
   }
 };
 
+template<typename T>
+struct Prototype<T, std::enable_if_t<!HasPrototypeDefine<T>::value &&
+                                     HasBuilderDefine<T>::value>> {
+  static inline void Build(ClassBuilder* builder) {
+    Type<T>::Define(builder);
+  }
+  static inline bool Define(napi_env env, napi_value constructor) {
+    return true;
+  }
+};
+
 template<typename, typename = void>
 struct InheritanceChain;
 
-// Create a new JS object with T's prorotype chain.
+// Create a new JS object with T's prorotype chain. The object is created with
+// Object.create(prototype) instead of "new Class", so the constructor is not
+// entered for objects created from native code.
 template<typename T>
 inline napi_value CreateInstance(napi_env env) {
-  // Pass an External to indicate it is called from native code.
-  napi_value external;
-  napi_status s = napi_create_external(env, GetConstructorKey(),
-                                       nullptr, nullptr, &external);
-  if (s != napi_ok)
+  if (!InheritanceChain<T>::Get(env))
     return nullptr;
-  // Create a JS object with "new Class(external)".
-  napi_value constructor = InheritanceChain<T>::Get(env);
-  napi_value object;
-  s = napi_new_instance(env, constructor, 1, &external, &object);
-  if (s != napi_ok)
+  napi_value prototype = InstanceData::Get(env)->GetPrototype(TypeIndex<T>());
+  if (!prototype)
     return nullptr;
-  return object;
+  return BuiltinFunction<kObjectKey, kCreateKey>(env).Call(Undefined(env),
+                                                           prototype);
 }
 
 // Define T's constructor according to its type traits.
 template<typename T, typename Enable = void>
 struct DefineClass {
   static napi_status Do(napi_env env, napi_value* result) {
+    // Note that napi_define_class does not support inheritance, check issue
+    // below for background, the prototype chain is connected afterwards by
+    // InheritanceChain.
+    // https://github.com/napi-rs/napi-rs/issues/1164
+    ClassBuilder builder(env);
+    Prototype<T>::Build(&builder);
     napi_value constructor;
-    napi_status s = napi_define_class(env, Type<T>::name, NAPI_AUTO_LENGTH,
-                                      &DummyConstructor, nullptr, 0, nullptr,
-                                      &constructor);
+    napi_status s = builder.DefineClass(Type<T>::name, &DummyConstructor,
+                                        nullptr, &constructor);
     if (s != napi_ok)
       return s;
-    // Note that we are not using napi_define_class to set prototype, because
-    // it does not support inheritance, check issue below for background.
-    // https://github.com/napi-rs/napi-rs/issues/1164
     if (!Prototype<T>::Define(env, constructor))
       return napi_generic_failure;
     *result = constructor;
@@ -228,10 +330,11 @@ struct DefineClass<T, typename std::enable_if<is_function_pointer<
                   "A type that has Type<T>::Constructor defined must also have "
                   "Type<T>::Destructor or TypeBridge<T>::Finalize defined.");
     auto holder = std::make_unique<HolderT>(&Type<T>::Constructor);
+    ClassBuilder builder(env);
+    Prototype<T>::Build(&builder);
     napi_value constructor;
-    napi_status s = napi_define_class(env, Type<T>::name, NAPI_AUTO_LENGTH,
-                                      &DispatchToCallback, holder.get(),
-                                      0, nullptr, &constructor);
+    napi_status s = builder.DefineClass(Type<T>::name, &DispatchToCallback,
+                                        holder.get(), &constructor);
     if (s != napi_ok)
       return s;
     if (!Prototype<T>::Define(env, constructor))
@@ -250,9 +353,6 @@ struct DefineClass<T, typename std::enable_if<is_function_pointer<
       ThrowError(env, "Constructor must be called with new.");
       return nullptr;
     }
-    // Let the caller do wrapping if this is called by CreateInstance<T>.
-    if (IsCalledFromConverter(args))
-      return nullptr;
     // Invoke native constructor.
     std::optional<T*> ptr = CallbackInvoker<Sig>::Invoke(&args);
     if (!ptr || !ptr.value()) {
@@ -265,14 +365,24 @@ struct DefineClass<T, typename std::enable_if<is_function_pointer<
     // Then wrap the native pointer.
     auto* data = Wrap<T>::Do(ptr.value());
     using DataType = decltype(data);
+    if (!object || TagObject(env, object) != napi_ok) {
+      Finalize<T>::Do(data);
+      Destruct<T>::Do(ptr.value());
+      ThrowError(env, "Unable to tag native object.");
+      return nullptr;
+    }
+    WrapData* wrap_data = NewWrapData<T>(data);
     napi_ref ref;
-    napi_status s = napi_wrap(env, object, data,
+    napi_status s = napi_wrap(env, object, wrap_data,
                               [](napi_env env, void* data, void* ptr) {
       InstanceData::Get(env)->DeleteWrapper<T>(ptr);
-      Finalize<T>::Do(static_cast<DataType>(data));
+      auto* wrap_data = static_cast<WrapData*>(data);
+      Finalize<T>::Do(static_cast<DataType>(wrap_data->data));
+      delete wrap_data;
       Destruct<T>::Do(static_cast<T*>(ptr));
     }, ptr.value(), &ref);
     if (s != napi_ok) {
+      delete wrap_data;
       Finalize<T>::Do(data);
       Destruct<T>::Do(ptr.value());
       ThrowError(env, "Unable to wrap native object.");
@@ -291,38 +401,41 @@ struct DefineClass<T, typename std::enable_if<is_function_pointer<
 template<typename T>
 bool GetOrCreateConstructor(napi_env env, napi_value* constructor) {
   // Get cached constructor.
-  static int key = 0x19980604;
   InstanceData* instance_data = InstanceData::Get(env);
-  if (instance_data->Get(&key, constructor))
+  if (instance_data->GetConstructor(TypeIndex<T>(), constructor))
     return true;
   // Create a new one if not found.
   napi_status s = DefineClass<T>::Do(env, constructor);
   assert(s == napi_ok);
+  napi_value prototype = nullptr;
+  if (!Get(env, *constructor, Key<kPrototypeKey>(), &prototype))
+    assert(false);
   // Cache it forever.
-  instance_data->Set(&key, *constructor);
+  instance_data->SetConstructor(TypeIndex<T>(), *constructor, prototype);
   return false;
 }
 
 // Implement inheritance with setPrototypeOf due to lack of native napi.
-inline void Inherit(napi_env env, napi_value child, napi_value parent) {
-  napi_value global, object, set_prototype_of, child_proto, parent_proto;
-  if (!(napi_get_global(env, &global) == napi_ok &&
-        Get(env, global, "Object", &object) &&
-        Get(env, object, "setPrototypeOf", &set_prototype_of) &&
-        Get(env, child, "prototype", &child_proto) &&
-        Get(env, parent, "prototype", &parent_proto))) {
+inline void Inherit(napi_env env, size_t child_index, size_t parent_index) {
+  InstanceData* instance_data = InstanceData::Get(env);
+  napi_value child, parent;
+  if (!instance_data->GetConstructor(child_index, &child) ||
+      !instance_data->GetConstructor(parent_index, &parent)) {
     assert(false);
     return;
   }
-  // Object.setPrototypeOf(Child, Parent.prototype)
-  napi_value args1[] = {child_proto, parent_proto};
-  napi_status s = napi_call_function(env, object, set_prototype_of, 2, args1,
-                                     nullptr);
-  assert(s == napi_ok);
+  napi_value undefined = Undefined(env);
+  MethodHandle set_prototype_of =
+      BuiltinFunction<kObjectKey, kSetPrototypeOfKey>(env);
+  // Object.setPrototypeOf(Child.prototype, Parent.prototype)
+  napi_value ret = set_prototype_of.Call(
+      undefined,
+      instance_data->GetPrototype(child_index),
+      instance_data->GetPrototype(parent_index));
+  assert(ret);
   // Object.setPrototypeOf(Child, Parent)
-  napi_value args2[] = {child, parent};
-  s = napi_call_function(env, object, set_prototype_of, 2, args2, nullptr);
-  assert(s == napi_ok);
+  ret = set_prototype_of.Call(undefined, child, parent);
+  assert(ret);
 }
 
 // Get constructor with populated prototype for T.
@@ -343,25 +456,14 @@ struct InheritanceChain<T, typename std::enable_if<std::is_class<
     napi_value constructor;
     if (!GetOrCreateConstructor<T>(env, &constructor)) {
       // Inherit from base type's constructor.
-      napi_value parent = InheritanceChain<typename Type<T>::Base>::Get(env);
-      Inherit(env, constructor, parent);
+      using Base = typename Type<T>::Base;
+      InheritanceChain<Base>::Get(env);
+      Inherit(env, TypeIndex<T>(), TypeIndex<Base>());
     }
     return constructor;
   }
 };
 
-// Return if JS |object| is an instance of |T|.
-template<typename T>
-bool IsInstanceOf(napi_env env, napi_value object) {
-  napi_value constructor;
-  if (!GetOrCreateConstructor<T>(env, &constructor))
-    return false;
-  bool result = false;
-  napi_instanceof(env, object, constructor, &result);
-  // TODO(zcbenz): Check native type tag.
-  return result;
-}
-
 }  // namespace internal
 
 }  // namespace ki
@@ -17,6 +17,7 @@ namespace ki {
 template<>
 struct Type<std::string> {
   static constexpr const char* name = "String";
+  static constexpr uint32_t kinds = kStringKind;
   static inline napi_status ToNode(napi_env env,
                                    const std::string& value,
                                    napi_value* result) {
@@ -42,6 +43,7 @@ struct Type<std::string> {
 template<>
 struct Type<std::u16string> {
   static constexpr const char* name = "String";
+  static constexpr uint32_t kinds = kStringKind;
   static inline napi_status ToNode(napi_env env,
                                    const std::u16string& value,
                                    napi_value* result) {
@@ -68,6 +70,7 @@ struct Type<std::u16string> {
 template<typename T>
 struct Type<std::vector<T>> {
   static constexpr const char* name = "Array";
+  static constexpr uint32_t kinds = kArrayKind;
   static napi_status ToNode(napi_env env,
                             const std::vector<T>& vec,
                             napi_value* result) {
@@ -86,7 +89,10 @@ struct Type<std::vector<T>> {
                                                 napi_value value) {
     std::vector<T> result;
     if (!IterateArray<T>(env, value,
-                         [&](uint32_t i, T value) {
+                         [&](uint32_t length) {
+                           result.reserve(length);
+                         },
+                         [&](uint32_t i, T&& value) {
                            result.push_back(std::move(value));
                            return true;
                          })) {
@@ -99,6 +105,7 @@ struct Type<std::vector<T>> {
 template<typename T>
 struct Type<std::set<T>> {
   static constexpr const char* name = "Array";
+  static constexpr uint32_t kinds = kArrayKind;
   static napi_status ToNode(napi_env env,
                             const std::set<T>& vec,
                             napi_value* result) {
@@ -118,7 +125,7 @@ struct Type<std::set<T>> {
                                              napi_value value) {
     std::set<T> result;
     if (!IterateArray<T>(env, value,
-                         [&](uint32_t i, T value) {
+                         [&](uint32_t i, T&& value) {
                            result.insert(std::move(value));
                            return true;
                          })) {
@@ -137,6 +144,7 @@ struct Type<T, std::enable_if_t<  // is map type
   using K = typename T::key_type;
   using V = typename T::mapped_type;
   static constexpr const char* name = "Object";
+  static constexpr uint32_t kinds = kObjectKind | kArrayKind;
   static napi_status ToNode(napi_env env,
                             const T& dict,
                             napi_value* result) {
@@ -158,7 +166,7 @@ struct Type<T, std::enable_if_t<  // is map type
                                    napi_value object) {
     T result;
     if (!IterateObject<K, V>(env, object,
-                             [&result](K key, V value) {
+                             [&result](K&& key, V&& value) {
                                result.emplace(std::move(key), std::move(value));
                                return true;
                              })) {
@@ -171,6 +179,8 @@ struct Type<T, std::enable_if_t<  // is map type
 template<typename T>
 struct Type<std::optional<T>> {
   static constexpr const char* name = Type<T>::name;
+  static constexpr uint32_t kinds =
+      internal::AcceptedKinds<T>::value | kUndefinedKind | kNullKind;
   static napi_status ToNode(napi_env env,
                             const std::optional<T>& value,
                             napi_value* result) {
@@ -178,6 +188,13 @@ struct Type<std::optional<T>> {
       return napi_get_null(env, result);
     return ConvertToNode(env, *value, result);
   }
+  static napi_status ToNode(napi_env env,
+                            std::optional<T>&& value,
+                            napi_value* result) {
+    if (!value)
+      return napi_get_null(env, result);
+    return ConvertToNode(env, std::move(*value), result);
+  }
   static std::optional<std::optional<T>> FromNode(napi_env env,
                                                   napi_value value) {
     napi_valuetype type;
@@ -194,6 +211,7 @@ struct Type<std::tuple<ArgTypes...>> {
   using V = std::tuple<ArgTypes...>;
 
   static constexpr const char* name = "Tuple";
+  static constexpr uint32_t kinds = kArrayKind;
   static napi_status ToNode(napi_env env, const V& tup, napi_value* result) {
     constexpr size_t length = sizeof...(ArgTypes);
     napi_value arr;
@@ -257,6 +275,7 @@ template<typename T1, typename T2>
 struct Type<std::pair<T1, T2>> {
   using V = std::pair<T1, T2>;
   static constexpr const char* name = "Pair";
+  static constexpr uint32_t kinds = kArrayKind;
   static inline napi_status ToNode(napi_env env,
                                    const V& pair,
                                    napi_value* result) {
@@ -276,6 +295,8 @@ struct Type<std::variant<ArgTypes...>> {
   using V = std::variant<ArgTypes...>;
 
   static constexpr const char* name = "Variant";
+  static constexpr uint32_t kinds =
+      (internal::AcceptedKinds<ArgTypes>::value | ...);
   static napi_status ToNode(napi_env env, const V& var, napi_value* result) {
     napi_status s = napi_generic_failure;
     std::visit([env, result, &s](const auto& arg) {
@@ -284,16 +305,48 @@ struct Type<std::variant<ArgTypes...>> {
     return s;
   }
   static inline std::optional<V> FromNode(napi_env env, napi_value value) {
-    return GetVar(env, value);
+    if constexpr (kUndeclaredKinds)
+      return GetVar(env, value, kAnyKind);
+    // Get the kind of value once, and only try the alternatives accepting it.
+    napi_valuetype type;
+    if (napi_typeof(env, value, &type) != napi_ok)
+      return std::nullopt;
+    uint32_t kind = 1 << type;
+    if (type == napi_object) {
+      if constexpr (kDistinguishArray)
+        kind = IsArray(env, value) ? kArrayKind : kObjectKind;
+      else
+        kind = kObjectKind | kArrayKind;
+    }
+    return GetVar(env, value, kind);
   }
 
  private:
+  // Whether no alternative declares the kinds it accepts.
+  static constexpr bool kUndeclaredKinds =
+      ((internal::AcceptedKinds<ArgTypes>::value == kAnyKind) && ...);
+
+  static constexpr bool AcceptsOnlyObjectOrArray(uint32_t kinds) {
+    return ((kinds & kObjectKind) == 0) != ((kinds & kArrayKind) == 0);
+  }
+
+  // Whether there is an alternative that accepts only one of objects and
+  // arrays, which requires checking whether an object is array.
+  static constexpr bool kDistinguishArray =
+      (AcceptsOnlyObjectOrArray(internal::AcceptedKinds<ArgTypes>::value) ||
+       ...);
+
   template<std::size_t I = 0>
-  static std::optional<V> GetVar(napi_env env, napi_value value) {
+  static std::optional<V> GetVar(napi_env env, napi_value value,
+                                 uint32_t kind) {
     if constexpr (I < std::variant_size_v<V>) {
       using T = std::variant_alternative_t<I, V>;
-      std::optional<T> result = FromNodeTo<T>(env, value);
-      return result ? std::move(*result) : GetVar<I + 1>(env, value);
+      if (internal::AcceptedKinds<T>::value & kind) {
+        std::optional<T> result = FromNodeTo<T>(env, value);
+        if (result)
+          return std::move(*result);
+      }
+      return GetVar<I + 1>(env, value, kind);
     }
     return std::nullopt;
   }
@@ -304,6 +357,7 @@ struct Type<std::variant<ArgTypes...>> {
 template<>
 struct Type<std::monostate> {
   static constexpr const char* name = "";  // no name for monostate
+  static constexpr uint32_t kinds = kUndefinedKind | kNullKind;
   static napi_status ToNode(napi_env env, std::monostate, napi_value* result) {
     return napi_get_null(env, result);
   }
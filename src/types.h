@@ -20,6 +20,39 @@ struct TypeBridge {};
 template<typename T, typename Enable = void>
 struct Type {};
 
+// Masks of the kinds of JS values. A converter can declare the kinds of values
+// accepted by its FromNode with |kinds|, so converting a variant can skip the
+// alternatives that would fail without calling them. Converters that do not
+// declare it are assumed to accept any value.
+enum ValueKind : uint32_t {
+  kUndefinedKind = 1 << napi_undefined,
+  kNullKind = 1 << napi_null,
+  kBooleanKind = 1 << napi_boolean,
+  kNumberKind = 1 << napi_number,
+  kStringKind = 1 << napi_string,
+  kSymbolKind = 1 << napi_symbol,
+  kObjectKind = 1 << napi_object,  // objects that are not arrays
+  kFunctionKind = 1 << napi_function,
+  kExternalKind = 1 << napi_external,
+  kBigIntKind = 1 << napi_bigint,
+  kArrayKind = 1 << 16,
+  kAnyKind = 0xFFFFFFFF,
+};
+
+namespace internal {
+
+template<typename T, typename Enable = void>
+struct AcceptedKinds {
+  static constexpr uint32_t value = kAnyKind;
+};
+
+template<typename T>
+struct AcceptedKinds<T, std::void_t<decltype(Type<T>::kinds)>> {
+  static constexpr uint32_t value = Type<T>::kinds;
+};
+
+}  // namespace internal
+
 template<>
 struct Type<napi_value> {
   static constexpr const char* name = "Value";
@@ -63,6 +96,7 @@ struct Type<void*> {
 template<>
 struct Type<uint8_t> {
   static constexpr const char* name = "Integer";
+  static constexpr uint32_t kinds = kNumberKind;
   static inline napi_status ToNode(napi_env env,
                                    uint8_t value,
                                    napi_value* result) {
@@ -80,6 +114,7 @@ struct Type<uint8_t> {
 template<>
 struct Type<uint16_t> {
   static constexpr const char* name = "Integer";
+  static constexpr uint32_t kinds = kNumberKind;
   static inline napi_status ToNode(napi_env env,
                                    uint16_t value,
                                    napi_value* result) {
@@ -97,6 +132,7 @@ struct Type<uint16_t> {
 template<>
 struct Type<int8_t> {
   static constexpr const char* name = "Integer";
+  static constexpr uint32_t kinds = kNumberKind;
   static inline napi_status ToNode(napi_env env,
                                    int8_t value,
                                    napi_value* result) {
@@ -113,6 +149,7 @@ struct Type<int8_t> {
 template<>
 struct Type<int16_t> {
   static constexpr const char* name = "Integer";
+  static constexpr uint32_t kinds = kNumberKind;
   static inline napi_status ToNode(napi_env env,
                                    int16_t value,
                                    napi_value* result) {
@@ -130,6 +167,7 @@ struct Type<int16_t> {
 template<>
 struct Type<int32_t> {
   static constexpr const char* name = "Integer";
+  static constexpr uint32_t kinds = kNumberKind;
   static inline napi_status ToNode(napi_env env,
                                    int32_t value,
                                    napi_value* result) {
@@ -147,6 +185,7 @@ struct Type<int32_t> {
 template<>
 struct Type<uint32_t> {
   static constexpr const char* name = "Integer";
+  static constexpr uint32_t kinds = kNumberKind;
   static inline napi_status ToNode(napi_env env,
                                    uint32_t value,
                                    napi_value* result) {
@@ -164,6 +203,7 @@ struct Type<uint32_t> {
 template<>
 struct Type<int64_t> {
   static constexpr const char* name = "Integer";
+  static constexpr uint32_t kinds = kNumberKind;
   static inline napi_status ToNode(napi_env env,
                                    int64_t value,
                                    napi_value* result) {
@@ -182,6 +222,7 @@ struct Type<int64_t> {
 template<>
 struct Type<size_t> {
   static constexpr const char* name = "Integer";
+  static constexpr uint32_t kinds = kNumberKind;
   static inline napi_status ToNode(napi_env env,
                                    size_t value,
                                    napi_value* result) {
@@ -200,6 +241,7 @@ struct Type<size_t> {
 template<>
 struct Type<float> {
   static constexpr const char* name = "Number";
+  static constexpr uint32_t kinds = kNumberKind;
   static inline napi_status ToNode(napi_env env,
                                    float value,
                                    napi_value* result) {
@@ -217,6 +259,7 @@ struct Type<float> {
 template<>
 struct Type<double> {
   static constexpr const char* name = "Number";
+  static constexpr uint32_t kinds = kNumberKind;
   static inline napi_status ToNode(napi_env env,
                                    double value,
                                    napi_value* result) {
@@ -234,6 +277,7 @@ struct Type<double> {
 template<>
 struct Type<uint64_t> {
   static constexpr const char* name = "Integer";
+  static constexpr uint32_t kinds = kNumberKind;
   static inline napi_status ToNode(napi_env env,
                                    uint64_t value,
                                    napi_value* result) {
@@ -251,6 +295,7 @@ struct Type<uint64_t> {
 template<>
 struct Type<bool> {
   static constexpr const char* name = "Boolean";
+  static constexpr uint32_t kinds = kBooleanKind;
   static inline napi_status ToNode(napi_env env,
                                    bool value,
                                    napi_value* result) {
@@ -330,38 +375,6 @@ struct Type<napi_env> {
   static constexpr const char* name = "Environment";
 };
 
-// Optimized helper for creating symbols.
-struct SymbolHolder {
-  bool symbol_for;
-  const char* str;
-};
-
-inline SymbolHolder Symbol(const char* str) {
-  return {false, str};
-}
-
-inline SymbolHolder SymbolFor(const char* str) {
-  return {true, str};
-}
-
-template<>
-struct Type<SymbolHolder> {
-  static constexpr const char* name = "Symbol";
-  static inline napi_status ToNode(napi_env env,
-                                   SymbolHolder value,
-                                   napi_value* result) {
-    napi_value symbol;
-    if (value.symbol_for) {
-      return node_api_symbol_for(env, value.str, NAPI_AUTO_LENGTH, result);
-    } else {
-      napi_status s = Type<const char*>::ToNode(env, value.str, &symbol);
-      if (s != napi_ok)
-        return s;
-      return napi_create_symbol(env, symbol, result);
-    }
-  }
-};
-
 // Some builtin types.
 inline napi_value Global(napi_env env) {
   napi_value result;
@@ -392,6 +405,13 @@ inline napi_value CreateObject(napi_env env) {
   return value;
 }
 
+inline napi_value CreateArray(napi_env env) {
+  napi_value value = nullptr;
+  napi_status s = napi_create_array(env, &value);
+  assert(s == napi_ok);
+  return value;
+}
+
 inline bool IsArray(napi_env env, napi_value value) {
   bool result = false;
   napi_is_array(env, value, &result);
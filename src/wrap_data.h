@@ -0,0 +1,184 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#ifndef SRC_WRAP_DATA_H_
+#define SRC_WRAP_DATA_H_
+
+#include <vector>
+
+#include "src/types.h"
+#include "src/persistent.h"
+
+namespace ki {
+
+namespace internal {
+
+// A cached property value of a wrapper, which is referenced by the native data
+// of the wrapper so reading it does not touch any JS object. Before Node-API
+// 10 primitives can not be referenced, so numbers and booleans are stored
+// natively and other primitives are boxed in arrays.
+//
+// The value of a wrapper referencing itself is stored as a flag, otherwise the
+// reference would keep the wrapper alive forever.
+class PropertySlot {
+ public:
+  explicit PropertySlot(const void* key) : key_(key) {}
+
+  const void* key() const { return key_; }
+
+  napi_status Get(napi_env env, napi_value object, napi_value* result) const {
+    switch (kind_) {
+      case Kind::Self:
+        *result = object;
+        return napi_ok;
+      case Kind::Value:
+        return napi_get_reference_value(env, value_.Id(), result);
+#if NAPI_VERSION < 10
+      case Kind::Boxed: {
+        napi_value box;
+        napi_status s = napi_get_reference_value(env, value_.Id(), &box);
+        if (s != napi_ok)
+          return s;
+        return napi_get_element(env, box, 0, result);
+      }
+      case Kind::Number:
+        return napi_create_double(env, number_, result);
+      case Kind::Boolean:
+        return napi_get_boolean(env, number_ != 0, result);
+      case Kind::Undefined:
+        return napi_get_undefined(env, result);
+      case Kind::Null:
+        return napi_get_null(env, result);
+#endif
+    }
+    return napi_generic_failure;
+  }
+
+  napi_status Set(napi_env env, napi_value object, napi_value value) {
+    napi_valuetype type;
+    napi_status s = napi_typeof(env, value, &type);
+    if (s != napi_ok)
+      return s;
+    value_ = Persistent();
+    if (type == napi_object) {
+      bool is_self = false;
+      s = napi_strict_equals(env, value, object, &is_self);
+      if (s != napi_ok)
+        return s;
+      if (is_self) {
+        kind_ = Kind::Self;
+        return napi_ok;
+      }
+    }
+#if NAPI_VERSION < 10
+    switch (type) {
+      case napi_object:
+      case napi_function:
+      case napi_external:
+        break;
+      case napi_number:
+        kind_ = Kind::Number;
+        return napi_get_value_double(env, value, &number_);
+      case napi_boolean: {
+        bool b = false;
+        s = napi_get_value_bool(env, value, &b);
+        number_ = b;
+        kind_ = Kind::Boolean;
+        return s;
+      }
+      case napi_undefined:
+        kind_ = Kind::Undefined;
+        return napi_ok;
+      case napi_null:
+        kind_ = Kind::Null;
+        return napi_ok;
+      default: {
+        napi_value box;
+        s = napi_create_array_with_length(env, 1, &box);
+        if (s != napi_ok)
+          return s;
+        s = napi_set_element(env, box, 0, value);
+        if (s != napi_ok)
+          return s;
+        value_ = Persistent(env, box);
+        kind_ = Kind::Boxed;
+        return napi_ok;
+      }
+    }
+#endif
+    value_ = Persistent(env, value);
+    kind_ = Kind::Value;
+    return napi_ok;
+  }
+
+ private:
+  enum class Kind {
+    Self,
+    Value,
+#if NAPI_VERSION < 10
+    Boxed,
+    Number,
+    Boolean,
+    Undefined,
+    Null,
+#endif
+  };
+
+  const void* key_;
+  Kind kind_ = Kind::Value;
+  Persistent value_;
+#if NAPI_VERSION < 10
+  double number_ = 0;
+#endif
+};
+
+// The data passed to napi_wrap, which records the class chain of the object
+// so checking whether it derives from a class at |depth| is a comparison of
+// ids[depth]. Note that napi_unwrap on a wrapper returns WrapData* instead of
+// the native pointer, code that unwraps kizunapi objects with Node-API
+// directly must read |data| from it.
+struct WrapData {
+  const void* const* ids;
+  size_t depth;
+  void* data;
+  // The cached property values, a class only has a few cached properties so
+  // they are searched linearly.
+  std::vector<PropertySlot> property_slots;
+  // Weak reference to the AttachedTable, which is kept alive by the WeakMap
+  // of tables as long as the wrapper is alive.
+  Persistent attached_table;
+};
+
+// The type tag which marks the objects that are wrapped with WrapData, each
+// module has its own tag so objects of other modules are never unwrapped as
+// WrapData.
+inline const napi_type_tag* GetTypeTag() {
+  static const char id = 0;
+  static const napi_type_tag tag = {reinterpret_cast<uintptr_t>(&id),
+                                    0x6b697a756e617069};  // "kizunapi"
+  return &tag;
+}
+
+// Tag the JS |object| as a wrapper.
+inline napi_status TagObject(napi_env env, napi_value object) {
+  return napi_type_tag_object(env, object, GetTypeTag());
+}
+
+// Return the WrapData of JS |object| if it is a wrapper.
+inline WrapData* GetWrapData(napi_env env, napi_value object) {
+  bool result = false;
+  if (napi_check_object_type_tag(env, object, GetTypeTag(),
+                                 &result) != napi_ok || !result) {
+    return nullptr;
+  }
+  void* data;
+  if (napi_unwrap(env, object, &data) != napi_ok)
+    return nullptr;
+  return static_cast<WrapData*>(data);
+}
+
+}  // namespace internal
+
+}  // namespace ki
+
+#endif  // SRC_WRAP_DATA_H_
@@ -0,0 +1,121 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#ifndef SRC_WRAPPER_TABLE_H_
+#define SRC_WRAPPER_TABLE_H_
+
+#include <assert.h>
+#include <node_api.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace ki {
+
+namespace internal {
+
+// Hash table from native pointers to the references of their JS wrappers,
+// which uses open addressing with linear probing so the references are stored
+// inline without allocating a node for each wrapper.
+//
+// In C++ the address of a class's first member data is equivalent to the
+// address of the class itself, so 1 pointer can actually represent 2
+// different instances. To avoid duplicate key for different instances, the
+// typename is also used as part of the key.
+class WrapperTable {
+ public:
+  WrapperTable() = default;
+
+  WrapperTable& operator=(const WrapperTable&) = delete;
+  WrapperTable(const WrapperTable&) = delete;
+
+  // Add a reference, the old reference of the same key is deleted.
+  void Add(napi_env env, const char* type, void* ptr, napi_ref ref) {
+    assert(ref);
+    if ((size_ + 1) * 4 > slots_.size() * 3)
+      Grow();
+    Slot& slot = slots_[Probe(type, ptr)];
+    if (slot.ref) {
+      napi_delete_reference(env, slot.ref);
+    } else {
+      slot.type = type;
+      slot.ptr = ptr;
+      size_++;
+    }
+    slot.ref = ref;
+  }
+
+  napi_ref Get(const char* type, void* ptr) const {
+    if (size_ == 0)
+      return nullptr;
+    return slots_[Probe(type, ptr)].ref;
+  }
+
+  // Delete the reference, the following slots are shifted back to fill the
+  // hole so no tombstone is needed.
+  bool Delete(napi_env env, const char* type, void* ptr) {
+    if (size_ == 0)
+      return false;
+    size_t i = Probe(type, ptr);
+    if (!slots_[i].ref)
+      return false;
+    napi_delete_reference(env, slots_[i].ref);
+    size_t mask = slots_.size() - 1;
+    for (size_t j = (i + 1) & mask; slots_[j].ref; j = (j + 1) & mask) {
+      // Move the slot to the hole if its home is not between the hole and it.
+      size_t home = Hash(slots_[j].type, slots_[j].ptr) & mask;
+      if (((j - home) & mask) >= ((j - i) & mask)) {
+        slots_[i] = slots_[j];
+        i = j;
+      }
+    }
+    slots_[i] = Slot();
+    size_--;
+    return true;
+  }
+
+  size_t Size() const {
+    return size_;
+  }
+
+ private:
+  struct Slot {
+    const char* type = nullptr;
+    void* ptr = nullptr;
+    napi_ref ref = nullptr;
+  };
+
+  static inline size_t Hash(const char* type, void* ptr) {
+    uint64_t h = reinterpret_cast<uintptr_t>(ptr) ^
+                 (reinterpret_cast<uintptr_t>(type) << 1);
+    h *= 0x9e3779b97f4a7c15;
+    return static_cast<size_t>(h ^ (h >> 32));
+  }
+
+  // Return the index of the slot of the key, or the empty slot to insert it.
+  size_t Probe(const char* type, void* ptr) const {
+    size_t mask = slots_.size() - 1;
+    size_t i = Hash(type, ptr) & mask;
+    while (slots_[i].ref && (slots_[i].ptr != ptr || slots_[i].type != type))
+      i = (i + 1) & mask;
+    return i;
+  }
+
+  void Grow() {
+    std::vector<Slot> old = std::move(slots_);
+    slots_ = std::vector<Slot>(old.empty() ? 16 : old.size() * 2);
+    for (const Slot& slot : old) {
+      if (slot.ref)
+        slots_[Probe(slot.type, slot.ptr)] = slot;
+    }
+  }
+
+  size_t size_ = 0;
+  std::vector<Slot> slots_;
+};
+
+}  // namespace internal
+
+}  // namespace ki
+
+#endif  // SRC_WRAPPER_TABLE_H_
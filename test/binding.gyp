@@ -17,6 +17,7 @@
       ],
       'sources': [
         'main.cc',
+        'buffer_types_tests.cc',
         'callback_tests.cc',
         'persistent_tests.cc',
         'property_tests.cc',
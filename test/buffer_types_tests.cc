@@ -0,0 +1,65 @@
+// Copyright (c) zcbenz.
+// Licensed under the MIT License.
+
+#include <kizunapi.h>
+
+namespace {
+
+double Sum(ki::Span<const double> numbers) {
+  double sum = 0;
+  for (double n : numbers)
+    sum += n;
+  return sum;
+}
+
+void Fill(ki::Span<uint8_t> bytes, uint8_t value) {
+  for (uint8_t& b : bytes)
+    b = value;
+}
+
+size_t BytesLength(ki::Bytes bytes) {
+  return bytes.size();
+}
+
+ki::ExternalTypedArray<double> VectorToTypedArray() {
+  std::vector<double> vec = {8, 9, 6, 4};
+  return ki::ExternalTypedArray<double>(std::move(vec));
+}
+
+ki::ExternalTypedArray<int32_t> UniquePtrToTypedArray(int32_t size) {
+  std::unique_ptr<int32_t[]> data(new int32_t[size]);
+  for (int32_t i = 0; i < size; ++i)
+    data[i] = i;
+  return ki::ExternalTypedArray<int32_t>(std::move(data), size);
+}
+
+ki::ExternalBuffer StringToBuffer(std::string str) {
+  return ki::ExternalBuffer(std::move(str));
+}
+
+ki::TypedVector<int32_t> Range(int32_t size) {
+  ki::TypedVector<int32_t> result;
+  for (int32_t i = 0; i < size; ++i)
+    result.push_back(i);
+  return result;
+}
+
+ki::TypedVector<double> Double(ki::TypedVector<double> numbers) {
+  for (double& n : numbers)
+    n *= 2;
+  return numbers;
+}
+
+}  // namespace
+
+void run_buffer_types_tests(napi_env env, napi_value binding) {
+  ki::Set(env, binding,
+          "sum", &Sum,
+          "fill", &Fill,
+          "bytesLength", &BytesLength,
+          "vectorToTypedArray", &VectorToTypedArray,
+          "uniquePtrToTypedArray", &UniquePtrToTypedArray,
+          "stringToBuffer", &StringToBuffer,
+          "range", &Range,
+          "double", &Double);
+}
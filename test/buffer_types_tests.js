@@ -0,0 +1,80 @@
+exports.runTests = (assert, binding) => {
+  const {sum, fill, bytesLength} = binding
+  assert.equal(sum(new Float64Array([1, 2, 3.5])), 6.5,
+               'Span read Float64Array')
+  assert.equal(sum(new Float64Array([1, 2, 3, 4]).subarray(1, 3)), 5,
+               'Span read TypedArray with offset')
+  assert.equal(sum(new Float64Array([8, 9]).buffer), 17,
+               'Span read ArrayBuffer')
+  assert.equal(sum(new DataView(new Float64Array([6, 4]).buffer)), 10,
+               'Span read DataView')
+  assert.throws(() => { sum(new Int32Array(2)) },
+                {
+                  name: 'TypeError',
+                  message: 'Error processing argument at index 0, conversion failure from Int32Array to Float64Array.',
+                },
+                'Span throw when element type does not match')
+  assert.throws(() => { sum(new ArrayBuffer(7)) },
+                /conversion failure from ArrayBuffer to Float64Array/,
+                'Span throw when ArrayBuffer size does not match')
+  assert.throws(() => { sum([1, 2]) },
+                /conversion failure from Array to Float64Array/,
+                'Span throw when passing Array')
+
+  const buffer = Buffer.alloc(4)
+  fill(buffer, 0x64)
+  assert.deepStrictEqual([...buffer], [0x64, 0x64, 0x64, 0x64],
+                         'Span write Buffer without copy')
+  const clamped = new Uint8ClampedArray(2)
+  fill(clamped, 0x89)
+  assert.deepStrictEqual([...clamped], [0x89, 0x89],
+                         'Span write Uint8ClampedArray without copy')
+
+  assert.equal(bytesLength(new Int32Array(4)), 16,
+               'Bytes read TypedArray of any type')
+  assert.equal(bytesLength(Buffer.from('8964')), 4, 'Bytes read Buffer')
+  assert.equal(bytesLength(new ArrayBuffer(3)), 3, 'Bytes read ArrayBuffer')
+  assert.equal(bytesLength(new DataView(new ArrayBuffer(8), 2)), 6,
+               'Bytes read DataView')
+
+  const {vectorToTypedArray, uniquePtrToTypedArray, stringToBuffer} = binding
+  const fromVector = vectorToTypedArray()
+  assert.ok(fromVector instanceof Float64Array,
+            'ExternalTypedArray create TypedArray of element type')
+  assert.deepStrictEqual([...fromVector], [8, 9, 6, 4],
+                         'ExternalTypedArray move vector to TypedArray')
+  assert.deepStrictEqual([...uniquePtrToTypedArray(4)], [0, 1, 2, 3],
+                         'ExternalTypedArray move unique_ptr to TypedArray')
+  assert.equal(uniquePtrToTypedArray(0).length, 0,
+               'ExternalTypedArray create empty TypedArray')
+  const buffer8964 = stringToBuffer('8964')
+  assert.ok(Buffer.isBuffer(buffer8964),
+            'ExternalBuffer create Buffer')
+  assert.equal(buffer8964.toString(), '8964',
+               'ExternalBuffer move string to Buffer')
+  assert.equal(stringToBuffer('a long string that is not stored inline').toString(),
+               'a long string that is not stored inline',
+               'ExternalBuffer move heap allocated string to Buffer')
+
+  const {range, double} = binding
+  assert.ok(range(3) instanceof Int32Array,
+            'TypedVector create TypedArray of element type')
+  assert.deepStrictEqual([...range(3)], [0, 1, 2],
+                         'TypedVector copy vector to TypedArray')
+  assert.equal(range(0).length, 0, 'TypedVector create empty TypedArray')
+  const input = new Float64Array([8, 9, 6, 4])
+  assert.deepStrictEqual([...double(input)], [16, 18, 12, 8],
+                         'TypedVector read TypedArray')
+  assert.deepStrictEqual([...input], [8, 9, 6, 4],
+                         'TypedVector copy TypedArray')
+  assert.deepStrictEqual([...double(input.subarray(1, 3))], [18, 12],
+                         'TypedVector read TypedArray with offset')
+  assert.deepStrictEqual([...double([6, 4])], [12, 8],
+                         'TypedVector read Array')
+  assert.throws(() => { double(new Float32Array(2)) },
+                /conversion failure from Float32Array to Float64Array/,
+                'TypedVector throw when element type does not match')
+  assert.throws(() => { double(['8964']) },
+                /conversion failure from Array to Float64Array/,
+                'TypedVector throw when Array has wrong element')
+}
@@ -33,6 +33,22 @@ class TestClass {
   int data;
 };
 
+uint32_t ArgumentsLength(const ki::Arguments& args) {
+  return args.Length();
+}
+
+uint32_t TakeArguments(ki::Arguments&& args) {
+  ki::Arguments taken = std::move(args);
+  return taken.Length();
+}
+
+int SumArguments(ki::Arguments* args) {
+  int sum = 0;
+  for (size_t i = 0; i < args->Length(); ++i)
+    sum += ki::FromNodeTo<int>(args->Env(), (*args)[i]).value_or(0);
+  return sum;
+}
+
 std::function<void()> stored_function;
 
 void StoreWeakFunction(ki::Arguments args) {
@@ -77,13 +93,21 @@ void run_callback_tests(napi_env env, napi_value binding) {
   ki::Set(env, binding, "returnVoid", &ReturnVoid,
                         "addOne", &AddOne,
                         "append64", &Append64,
-                        "nullFunction", std::function<void()>());
+                        "nullFunction", std::function<void()>(),
+                        "argumentsLength", &ArgumentsLength,
+                        "sumArguments", &SumArguments,
+                        "takeArguments", &TakeArguments);
 
   TestClass* object = new TestClass(8963);
   ki::Set(env, binding, "object", object,
                         "method", &TestClass::Method,
                         "data", &TestClass::Data);
 
+  ki::Set(env, binding, "fnAddOne", ki::Fn<&AddOne>(),
+                        "fnAppend64", ki::Fn<&Append64>(),
+                        "fnMethod", ki::Fn<&TestClass::Method>(),
+                        "fnData", ki::Fn<&TestClass::Data>());
+
   ki::Set(env, binding, "storeWeakFunction", &StoreWeakFunction,
                         "runStoredFunction", &RunStoredFunction,
                         "clearStoredFunction", &ClearStoredFunction);
@@ -16,6 +16,15 @@ exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer
   assert.equal(binding.nullFunction, null,
                'Callback convert null function to null')
 
+  assert.equal(binding.argumentsLength(1, 2, 3), 3,
+               'Callback pass Arguments by reference')
+  assert.equal(binding.takeArguments(1, 2), 2,
+               'Callback take Arguments by rvalue reference')
+  assert.equal(binding.sumArguments(1, 2, 3), 6,
+               'Callback read Arguments stored inline')
+  assert.equal(binding.sumArguments(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12), 78,
+               'Callback read Arguments exceeding inline storage')
+
   binding.method.call(binding.object, 1)
   assert.equal(binding.data.call(binding.object), 8964,
                'Callback convert member function to js')
@@ -27,6 +36,25 @@ exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer
                 },
                 'Callback throw when |this| does not match member function')
 
+  assert.equal(binding.fnAddOne(123), 124, 'Callback Fn convert arg from js')
+  assert.throws(() => { binding.fnAddOne('string') },
+                {
+                  name: 'TypeError',
+                  message: 'Error processing argument at index 0, conversion failure from String to Integer.',
+                },
+                'Callback Fn throw when arg type does not match')
+  assert.equal(binding.fnAppend64(() => '89'), '8964',
+               'Callback Fn convert js function to std::function')
+  binding.fnMethod.call(binding.object, 1)
+  assert.equal(binding.fnData.call(binding.object), 8965,
+               'Callback Fn convert member function to js')
+  assert.throws(() => { binding.fnMethod() },
+                {
+                  name: 'TypeError',
+                  message: 'Error converting "this" to TestClass.',
+                },
+                'Callback Fn throw when |this| does not match member function')
+
   await runInNewScope(async () => {
     let someFunctionCollected = false
     runInNewScope(() => {
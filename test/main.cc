@@ -45,6 +45,7 @@ napi_value Init(napi_env env, napi_value exports) {
   ki::Set(env, exports,
           "addFinalizer", &AddFinalizer,
           "getAttachedTable", &GetAttachedTable);
+  TEST(buffer_types);
   TEST(callback);
   TEST(persistent);
   TEST(property);
@@ -15,6 +15,10 @@ void Setter(int n) {
   number = n + 1;
 }
 
+napi_value Self(ki::Arguments args) {
+  return args.This();
+}
+
 struct SimpleMember {
   int data = 89;
   std::function<void()> callback;
@@ -23,8 +27,32 @@ struct SimpleMember {
 struct HasObjectMember {
   SimpleMember* member = new SimpleMember;
   SimpleMember* strong = new SimpleMember;
+  int reads = 0;
+
+  int Reads() { return ++reads; }
+
+  int labels = 0;
+  std::string Label() { return "label" + std::to_string(++labels); }
+};
+
+struct Point {
+  int x = 89;
+  int y = 64;
+
+  int Sum() const { return x + y; }
+
+  int Scale() const { return scale; }
+  void SetScale(int s) { scale = s; }
+
+ private:
+  int scale = 1;
 };
 
+constexpr char kX[] = "x";
+constexpr char kY[] = "y";
+constexpr char kSum[] = "sum";
+constexpr char kScale[] = "scale";
+
 }  // namespace
 
 namespace ki {
@@ -64,7 +92,32 @@ struct Type<HasObjectMember> {
     DefineProperties(env, prototype,
                      Property("member", &HasObjectMember::member),
                      Property("strong", &HasObjectMember::strong,
-                              Property::CacheMode::GetterAndSetter));
+                              Property::CacheMode::GetterAndSetter),
+                     Property("reads", Getter(&HasObjectMember::Reads),
+                              Property::CacheMode::Getter),
+                     Property("label", Getter(&HasObjectMember::Label),
+                              Property::CacheMode::Getter),
+                     Property("self", Getter(&Self),
+                              Property::CacheMode::Getter));
+  }
+};
+
+template<>
+struct Type<Point> {
+  static constexpr const char* name = "Point";
+  static Point* Constructor() {
+    return new Point;
+  }
+  static void Destructor(Point* ptr) {
+    delete ptr;
+  }
+  static void Define(napi_env env, napi_value, napi_value prototype) {
+    DefineProperties(env, prototype,
+                     Properties<Prop<kX, &Point::x>,
+                                Prop<kY, &Point::y, nullptr>,
+                                Prop<kSum, &Point::Sum>,
+                                Prop<kScale, &Point::Scale,
+                                     &Point::SetScale>>());
   }
 };
 
@@ -74,8 +127,11 @@ void run_property_tests(napi_env env, napi_value binding) {
   ki::DefineProperties(
       env, binding,
       ki::Property("value", ki::ToNodeValue(env, "value")),
-      ki::Property("number", ki::Getter(&Getter), ki::Setter(&Setter)));
+      ki::Property("number", ki::Getter(&Getter), ki::Setter(&Setter)),
+      ki::Property("cachedNumber", ki::Getter(&Getter), ki::Setter(&Setter),
+                   ki::Property::CacheMode::Getter));
   ki::Set(env, binding,
           "member", new SimpleMember,
-          "HasObjectMember", ki::Class<HasObjectMember>());
+          "HasObjectMember", ki::Class<HasObjectMember>(),
+          "Point", ki::Class<Point>());
 }
@@ -11,6 +11,10 @@ exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer
   delete binding.number
   assert.equal(binding.number, 90,
                'Property setter defaults to not configurable')
+  assert.equal(binding.cachedNumber, 90, 'Property cached getter')
+  binding.cachedNumber = 8964
+  assert.equal(binding.cachedNumber, 90,
+               'Property cached getter of plain object')
 
   let callbackCollected
   runInNewScope(() => {
@@ -31,6 +35,48 @@ exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer
   member.data = 8964
   assert.equal(member.data, 8964,
                'Property member data pointer to getter and setter')
+  assert.throws(() => { member.data = 'string' }, {
+    name: 'TypeError',
+    message: 'Error processing argument at index 0, conversion failure from String to Integer.',
+  }, 'Property member data pointer setter checks value')
+  const dataGetter =
+      Object.getOwnPropertyDescriptor(Object.getPrototypeOf(member), 'data').get
+  assert.throws(() => dataGetter.call({}), {
+    name: 'TypeError',
+    message: 'Error converting "this" to SimpleMember.',
+  }, 'Property member data pointer getter checks this')
+
+  const {Point} = binding
+  const point = new Point
+  assert.equal(point.x, 89, 'Properties member object getter')
+  point.x = 8
+  assert.equal(point.x, 8, 'Properties member object setter')
+  assert.throws(() => { point.x = {} }, {
+    name: 'TypeError',
+    message: 'Error processing argument at index 0, conversion failure from Object to Integer.',
+  }, 'Properties member object setter checks value')
+  const xGetter = Object.getOwnPropertyDescriptor(Point.prototype, 'x').get
+  assert.throws(() => xGetter.call(member), {
+    name: 'TypeError',
+    message: 'Error converting "this" to Point.',
+  }, 'Properties member object getter checks this')
+  assert.equal(point.y, 64, 'Properties read-only member object getter')
+  assert.equal(Object.getOwnPropertyDescriptor(Point.prototype, 'y').set,
+               undefined, 'Properties read-only member object has no setter')
+  assert.equal(point.sum, 72, 'Properties method getter')
+  assert.equal(point.scale, 1, 'Properties method getter with setter')
+  point.scale = 4
+  assert.equal(point.scale, 4, 'Properties method setter')
+  assert.deepStrictEqual(Object.keys(Point.prototype),
+                         ['x', 'y', 'sum', 'scale'],
+                         'Properties are enumerable')
+  assert.throws(() => { Object.getOwnPropertyDescriptor(Point.prototype, 'x')
+                          .get.call({}) },
+                {
+                  name: 'TypeError',
+                  message: 'Error converting "this" to Point.',
+                },
+                'Properties check the type of receiver')
 
   const {HasObjectMember} = binding
   const has = new HasObjectMember
@@ -39,6 +85,23 @@ exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer
   has.member = member
   assert.equal(has.member.data, 8964,
                'Property change object pointer property')
+  assert.equal(has.reads, 1, 'Property cached getter of wrapper')
+  assert.equal(has.reads, 1, 'Property cached getter returns cached value')
+  assert.equal(new HasObjectMember().reads, 1,
+               'Property cached values are stored per wrapper')
+  assert.equal(has.label, 'label1', 'Property cached string getter')
+  assert.equal(has.label, 'label1',
+               'Property cached string getter returns cached value')
+
+  let selfCollected
+  runInNewScope(() => {
+    const self = new HasObjectMember
+    assert.equal(self.self, self, 'Property cached getter returns receiver')
+    addFinalizer(self, () => selfCollected = true)
+  })
+  await gcUntil(() => selfCollected)
+  assert.equal(selfCollected, true,
+               'Property cached value referencing its wrapper gets GCed')
 
   const life = new HasObjectMember
   life.member.customData = 123
@@ -11,6 +11,18 @@ class SimpleClass {
 class ClassWithConstructor {
 };
 
+class FunctionCallable {
+ public:
+  static int count_;
+
+  static int Count() { return count_; }
+
+  FunctionCallable() { count_++; }
+};
+
+// static
+int FunctionCallable::count_ = 0;
+
 class ThrowInConstructor {
  public:
   explicit ThrowInConstructor(napi_env env) {
@@ -61,6 +73,16 @@ class Child : public Parent {
   }
 };
 
+// A class whose members are defined with ClassBuilder.
+class BuiltChild : public Parent {
+ public:
+  int ChildMethod() {
+    return 64;
+  }
+
+  int value = 8964;
+};
+
 Parent* ChildToParent(Child* child) {
   return child;
 }
@@ -142,6 +164,14 @@ T PassThrough(T val) {
   return val;
 }
 
+RefCounted* CreateRefCounted() {
+  return new RefCounted;
+}
+
+size_t WrappersCount(napi_env env) {
+  return ki::InstanceData::Get(env)->GetWrappersCount();
+}
+
 }  // namespace
 
 namespace ki {
@@ -162,6 +192,21 @@ struct Type<ClassWithConstructor> {
   }
 };
 
+template<>
+struct Type<FunctionCallable> {
+  static constexpr const char* name = "FunctionCallable";
+  static constexpr bool allow_function_call = true;
+  static FunctionCallable* Constructor() {
+    return new FunctionCallable;
+  }
+  static void Destructor(FunctionCallable* ptr) {
+    delete ptr;
+  }
+  static void Define(napi_env env, napi_value constructor, napi_value) {
+    Set(env, constructor, "count", &FunctionCallable::Count);
+  }
+};
+
 template<>
 struct Type<ThrowInConstructor> {
   static constexpr const char* name = "ThrowInConstructor";
@@ -219,6 +264,22 @@ struct Type<Child> {
   }
 };
 
+template<>
+struct Type<BuiltChild> {
+  using Base = Parent;
+  static constexpr const char* name = "BuiltChild";
+  static BuiltChild* Constructor() {
+    return new BuiltChild();
+  }
+  static void Define(ClassBuilder* builder) {
+    builder->Set("childMethod", Fn<&BuiltChild::ChildMethod>());
+    builder->DefineProperties(Property("value", &BuiltChild::value));
+    builder->SetStatic("kind", "child");
+    builder->SetLazy("lazyMethod", &BuiltChild::ChildMethod,
+                     "lazyValue", 8964);
+  }
+};
+
 template<typename T>
 struct TypeBridge<T, typename std::enable_if<std::is_base_of<
                          Parent, T>::value>::type> {
@@ -275,16 +336,20 @@ void run_prototype_tests(napi_env env, napi_value binding) {
           "SimpleClass", ki::Class<SimpleClass>(),
           "ClassWithConstructor", ki::Class<ClassWithConstructor>(),
           "pointerOfClass", &PointerOf<ClassWithConstructor>,
+          "FunctionCallable", ki::Class<FunctionCallable>(),
           "ThrowInConstructor", ki::Class<ThrowInConstructor>());
 
   RefCounted* ref_counted = new RefCounted;
   ki::Set(env, binding,
           "refCounted", ref_counted,
           "RefCounted", ki::Class<RefCounted>(),
-          "passThroughRefCounted", &PassThrough<RefCounted*>);
+          "passThroughRefCounted", &PassThrough<RefCounted*>,
+          "createRefCounted", &CreateRefCounted,
+          "wrappersCount", &WrappersCount);
 
   ki::Set(env, binding,
           "Child", ki::Class<Child>(),
+          "BuiltChild", ki::Class<BuiltChild>(),
           "Parent", ki::Class<Parent>(),
           "childToParent", &ChildToParent,
           "pointerOfParent", &PointerOf<Parent>,
@@ -1,3 +1,5 @@
+const {Worker} = require('worker_threads')
+
 exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer}) => {
   const {SimpleClass} = binding
   assert.throws(() => { new SimpleClass },
@@ -20,6 +22,13 @@ exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer
                 },
                 'Prototype throw when invoking constructor without new')
 
+  const {FunctionCallable} = binding
+  const functionCallable = FunctionCallable()
+  assert.ok(functionCallable instanceof FunctionCallable,
+            'Prototype can create class with function call')
+  assert.equal(FunctionCallable.count(), 1,
+               'Prototype calls native constructor once for function call')
+
   const {ThrowInConstructor} = binding
   assert.throws(() => { new ThrowInConstructor() },
                 {
@@ -40,6 +49,22 @@ exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer
   assert.equal((new RefCounted).count(), 1,
                'Prototype constructor and wrap work together')
 
+  const {createRefCounted, wrappersCount} = binding
+  const wrappersBefore = wrappersCount()
+  runInNewScope(() => {
+    const objects = []
+    for (let i = 0; i < 1000; ++i)
+      objects.push(createRefCounted())
+    assert.equal(wrappersCount(), wrappersBefore + 1000,
+                 'Prototype stores wrappers of pointers')
+    assert.ok(objects.every((o) => passThroughRefCounted(o) === o),
+              'Prototype finds wrappers of pointers')
+    assert.ok(objects.every((o) => o.constructor === RefCounted),
+              'Prototype creates wrappers with class prototype')
+  })
+  await gcUntil(() => wrappersCount() <= wrappersBefore)
+  assert.ok(true, 'Prototype removes wrappers of collected objects')
+
   const {pointerOfChild, pointerOfParent, Child, Parent} = binding
   const child = new Child
   const parent = new Parent
@@ -55,6 +80,49 @@ exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer
                 'Prototype parent can not convert to child')
   assert.equal(child.parentMethod(), 89,
                'Prototype child can call parent method')
+  const {BuiltChild} = binding
+  const builtChild = new BuiltChild
+  assert.equal(builtChild.childMethod(), 64, 'ClassBuilder method')
+  assert.equal(builtChild.parentMethod(), 89, 'ClassBuilder inherits methods')
+  assert.ok(builtChild instanceof Parent, 'ClassBuilder inherits parent class')
+  assert.equal(builtChild.value, 8964, 'ClassBuilder property')
+  assert.equal(BuiltChild.kind, 'child', 'ClassBuilder static value')
+  assert.deepStrictEqual(Object.keys(BuiltChild.prototype),
+                         ['childMethod', 'value', 'lazyMethod', 'lazyValue'],
+                         'ClassBuilder defines members on prototype')
+  assert.equal(typeof Object.getOwnPropertyDescriptor(BuiltChild.prototype,
+                                                      'lazyMethod').get,
+               'function', 'ClassBuilder lazy member starts as accessor')
+  assert.equal(builtChild.lazyMethod(), 64, 'ClassBuilder lazy method')
+  assert.equal(Object.getOwnPropertyDescriptor(BuiltChild.prototype,
+                                               'lazyMethod').value,
+               builtChild.lazyMethod,
+               'ClassBuilder lazy member is replaced with value')
+  assert.equal(new BuiltChild().lazyMethod, builtChild.lazyMethod,
+               'ClassBuilder lazy member is shared by instances')
+  builtChild.lazyValue = 89
+  assert.equal(builtChild.lazyValue, 89, 'ClassBuilder lazy member assignment')
+  assert.equal(new BuiltChild().lazyValue, 8964,
+               'ClassBuilder lazy member assignment only changes receiver')
+  const fakeChild = new Parent
+  Object.setPrototypeOf(fakeChild, Child.prototype)
+  assert.throws(() => { pointerOfChild(fakeChild) },
+                /conversion failure from Child to Child/,
+                'Prototype type check ignores prototype chain')
+  assert.throws(() => { fakeChild.childMethod() },
+                {
+                  name: 'TypeError',
+                  message: 'Error converting "this" to Child.',
+                },
+                'Prototype method checks type of receiver')
+  assert.throws(() => { pointerOfChild(builtChild) },
+                /conversion failure from BuiltChild to Child/,
+                'Prototype type check rejects sibling class')
+  assert.equal(pointerOfParent(builtChild) > 0, true,
+               'Prototype type check accepts subclass')
+  class JSChild extends Child {}
+  assert.equal(pointerOfParent(new JSChild) > 0, true,
+               'Prototype JS subclass can convert to native')
 
   const {childToParent} = binding
   const sameChild = childToParent(child)
@@ -78,6 +146,24 @@ exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer
   await gcUntil(() => weakFactoryCollected)
   assert.ok(true, 'Prototype wrap and unwrap internal pointer from js')
 
+  const workerResult = await new Promise((resolve, reject) => {
+    const bindingPath = require.resolve('./build/Debug/ki_tests')
+    const worker = new Worker(`
+      const {parentPort} = require('worker_threads')
+      const {prototype} = require(${JSON.stringify(bindingPath)})
+      const child = new prototype.Child
+      parentPort.postMessage(prototype.pointerOfParent(child) > 0 &&
+                             child.childMethod())
+    `, {eval: true})
+    let result
+    worker.on('message', (message) => result = message)
+    worker.on('error', reject)
+    worker.on('exit', () => resolve(result))
+  })
+  assert.equal(workerResult, 64, 'Prototype works in worker threads')
+  assert.equal(new Child().childMethod(), 64,
+               'Prototype works after worker threads exit')
+
   const {Copiable, passThroughCopiable} = binding
 
   let copiableCollected
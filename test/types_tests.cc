@@ -3,6 +3,8 @@
 
 #include <kizunapi.h>
 
+#include <limits>
+
 namespace {
 
 template<typename T>
@@ -10,8 +12,102 @@ T Passthrough(const T& value) {
   return value;
 }
 
+constexpr char kKey[] = "key";
+constexpr char kObject[] = "Object";
+constexpr char kKeys[] = "keys";
+constexpr char kArray[] = "Array";
+constexpr char kPush[] = "push";
+
+std::optional<std::string> GetKey(napi_env env, napi_value object) {
+  std::string value;
+  if (!ki::Get(env, object, ki::Key<kKey>(), &value))
+    return std::nullopt;
+  return value;
+}
+
+ki::SymbolHolder GetSymbolFor() {
+  return ki::SymbolFor("sym");
+}
+
+// Push |value| twice with the method resolved once.
+void PushTwice(napi_env env, napi_value array, int value) {
+  ki::MethodHandle push(env, array, "push");
+  push.Call(array, value);
+  push.Call(array, value);
+}
+
+bool CallMissingMethod(napi_env env, napi_value object) {
+  return ki::MethodHandle(env, object, "missing").Call(object) != nullptr;
+}
+
+std::optional<int> MapGet(napi_env env, napi_value map, std::string key) {
+  int value;
+  if (!ki::Map(env, map).Get(key, &value))
+    return std::nullopt;
+  return value;
+}
+
+napi_value GetBuiltins(napi_env env) {
+  return ki::ToNodeValue(env, std::make_tuple(
+      ki::BuiltinConstructor<kObject>(env),
+      ki::BuiltinFunction<kObject, kKeys>(env).Value(),
+      ki::BuiltinMethod<kArray, kPush>(env).Value()));
+}
+
+void WeakMapSet(napi_env env, napi_value map, napi_value key, int value) {
+  ki::WeakMap(env, map).Set(key, value);
+}
+
+napi_value WeakMapGetOrCreateMap(napi_env env, napi_value map,
+                                 napi_value key) {
+  ki::WeakMap weak_map(env, map);
+  ki::Map& base = weak_map;
+  return base.GetOrCreateMap(key).Value();
+}
+
+using Record = std::map<std::string,
+                         std::variant<int, double, std::string, bool,
+                                      std::optional<int>,
+                                      std::vector<float>,
+                                      std::map<int, std::string>,
+                                      std::pair<int64_t, std::set<int>>>>;
+
+std::vector<Record> MakeRecords() {
+  return {
+    {{"int", -8964}, {"double", 0.1}, {"large", 1e21}, {"zero", -0.0},
+     {"bool", true}, {"null", std::optional<int>()}},
+    {{"string", "字符串 \"quoted\" \\ /"},
+     {std::string("control\n\t\x01\0", 11), std::string("\x1f\r", 2)}},
+    {{"floats", std::vector<float>{3.14f, 89.64f}},
+     {"map", std::map<int, std::string>{{89, "64"}, {-1, ""}}},
+     {"pair", std::make_pair(int64_t(1) << 40, std::set<int>{8, 9, 6, 4})}},
+    {},
+  };
+}
+
+struct Size {
+  int width = 0;
+  int height = 0;
+  std::optional<std::string> unit;
+};
+
+constexpr char kWidth[] = "width";
+constexpr char kHeight[] = "height";
+constexpr char kUnit[] = "unit";
+
 }  // namespace
 
+namespace ki {
+
+template<>
+struct Type<Size> : Fields<Field<kWidth, &Size::width>,
+                           Field<kHeight, &Size::height>,
+                           Field<kUnit, &Size::unit>> {
+  static constexpr const char* name = "Size";
+};
+
+}  // namespace ki
+
 void run_types_tests(napi_env env, napi_value binding) {
   ki::Set(env, binding,
           "value", ki::ToNodeValue(env, "value"),
@@ -24,6 +120,9 @@ void run_types_tests(napi_env env, napi_value binding) {
           "charptr", "チャーポインター",
           "ucharptr", u"ucharptr",
           "symbol", ki::Symbol("sym"),
+          ki::Key<kKey>(), "cached key",
+          "getKey", &GetKey,
+          "symbolFor", &GetSymbolFor,
           "tuple", std::tuple<int, bool, std::string>(89, true, "64"),
           "pair", std::pair<std::string, std::string>("a", "pair"),
           "variant", std::variant<bool, int>(8964),
@@ -31,5 +130,21 @@ void run_types_tests(napi_env env, napi_value binding) {
           "passTuple", &Passthrough<std::tuple<int, int>>,
           "passPair", &Passthrough<std::pair<int, int>>,
           "passVariant", &Passthrough<std::variant<float, std::string>>,
-          "passMap", &Passthrough<std::map<std::string, int>>);
+          "passKinds", &Passthrough<std::variant<int, std::string,
+                                                 std::vector<int>,
+                                                 std::map<std::string, int>>>,
+          "passMap", &Passthrough<std::map<std::string, int>>,
+          "size", Size{89, 64, "px"},
+          "passSize", &Passthrough<Size>,
+          "records", MakeRecords(),
+          "recordsAsJSON", ki::AsJSON(MakeRecords()),
+          "notFiniteAsJSON", ki::AsJSON(std::make_tuple(
+              std::numeric_limits<double>::quiet_NaN(),
+              -std::numeric_limits<double>::infinity())),
+          "pushTwice", &PushTwice,
+          "callMissingMethod", &CallMissingMethod,
+          "mapGet", &MapGet,
+          "weakMapSet", &WeakMapSet,
+          "weakMapGetOrCreateMap", &WeakMapGetOrCreateMap,
+          "getBuiltins", &GetBuiltins);
 }
@@ -9,6 +9,14 @@ exports.runTests = (assert, binding) => {
   assert.equal(binding.charptr, 'チャーポインター', 'ToNode charptr')
   assert.equal(binding.ucharptr, 'ucharptr', 'ToNode ucharptr')
   assert.equal(typeof binding.symbol, 'symbol', 'ToNode symbol')
+  assert.notEqual(binding.symbol, Symbol.for('sym'), 'ToNode unique symbol')
+  assert.equal(binding.symbolFor(), Symbol.for('sym'), 'ToNode SymbolFor')
+  assert.equal(binding.symbolFor(), binding.symbolFor(),
+               'ToNode cached SymbolFor')
+  assert.equal(binding.key, 'cached key', 'ToNode Key')
+  assert.equal(binding.getKey({key: 'a'}), 'a', 'Get with Key')
+  assert.equal(binding.getKey({key: 'b'}), 'b', 'Get with cached Key')
+  assert.equal(binding.getKey({}), null, 'Get with Key missing')
   assert.deepStrictEqual(binding.tuple, [89, true, '64'], 'ToNode tuple')
   assert.deepStrictEqual(binding.pair, ['a', 'pair'], 'ToNode pair')
   assert.equal(binding.variant, 8964, 'ToNode variant')
@@ -23,6 +31,73 @@ exports.runTests = (assert, binding) => {
   assert.throws(() => binding.passVariant(false),
                 /Error processing argument at index 0/,
                 'FromNode variant throws')
+  assert.equal(binding.passKinds(89), 89, 'FromNode variant by number kind')
+  assert.equal(binding.passKinds('64'), '64',
+               'FromNode variant by string kind')
+  assert.deepStrictEqual(binding.passKinds([8, 9]), [8, 9],
+                         'FromNode variant by array kind')
+  assert.deepStrictEqual(binding.passKinds({a: 1}), {a: 1},
+                         'FromNode variant by object kind')
+  assert.throws(() => binding.passKinds(null),
+                /Error processing argument at index 0/,
+                'FromNode variant throws when no kind matches')
   assert.deepStrictEqual(binding.passMap({'str': 123}), {'str': 123},
                          'FromNode map')
+  const mapObject = Object.create({inherited: 1})
+  mapObject[2] = 3
+  mapObject[Symbol('symbol')] = 4
+  assert.deepStrictEqual(binding.passMap(mapObject), {'2': 3},
+                         'FromNode map reads own string keys')
+  assert.deepStrictEqual(binding.size, {width: 89, height: 64, unit: 'px'},
+                         'ToNode Fields')
+  assert.deepStrictEqual(Object.keys(binding.passSize({height: 6, width: 4})),
+                         ['width', 'height', 'unit'],
+                         'ToNode Fields in order')
+  assert.deepStrictEqual(binding.passSize({width: 8, height: 9}),
+                         {width: 8, height: 9, unit: null},
+                         'FromNode Fields with missing optional field')
+  assert.deepStrictEqual(
+      binding.passSize(Object.create({width: 1, height: 2, unit: 'em'})),
+      {width: 1, height: 2, unit: 'em'},
+      'FromNode Fields reads inherited properties')
+  assert.throws(() => binding.passSize({width: 8}),
+                {
+                  name: 'TypeError',
+                  message: 'Error processing argument at index 0, conversion failure from Object to Size.',
+                },
+                'FromNode Fields throws with missing field')
+  assert.throws(() => binding.passSize(8964),
+                /conversion failure from Number to Size/,
+                'FromNode Fields throws with non-object')
+  assert.deepStrictEqual(binding.recordsAsJSON, binding.records,
+                         'ToNode AsJSON same with ToNode')
+  assert.equal(binding.recordsAsJSON[1]['control\n\t\x01\0'], '\x1f\r',
+               'ToNode AsJSON escapes control characters')
+  assert.deepStrictEqual(binding.notFiniteAsJSON, [null, null],
+                         'ToNode AsJSON converts NaN and Infinity to null')
+  const array = []
+  binding.pushTwice(array, 8964)
+  assert.deepStrictEqual(array, [8964, 8964], 'MethodHandle call')
+  assert.equal(binding.callMissingMethod({}), false,
+               'MethodHandle missing method')
+  assert.equal(binding.mapGet(new Map([['key', 8964]]), 'key'), 8964,
+               'Map get with builtin method')
+  assert.equal(binding.mapGet(new Map, 'key'), null,
+               'Map get missing key')
+  const mapLike = {get: (key) => key == 'key' ? 89 : undefined}
+  assert.equal(binding.mapGet(mapLike, 'key'), 89,
+               'Map get calls method of Map-like object')
+  const throwingMap = {get: () => { throw new Error('get failed') }}
+  assert.throws(() => { binding.mapGet(throwingMap, 'key') }, /get failed/,
+                'Map get keeps exception of Map-like object')
+  const weakMap = new WeakMap
+  binding.weakMapSet(weakMap, array, 89)
+  assert.equal(weakMap.get(array), 89, 'WeakMap set with builtin method')
+  const nested = binding.weakMapGetOrCreateMap(weakMap, binding)
+  assert.ok(nested instanceof Map, 'WeakMap create nested Map')
+  assert.equal(binding.weakMapGetOrCreateMap(weakMap, binding), nested,
+               'WeakMap get nested Map')
+  assert.deepStrictEqual(binding.getBuiltins(),
+                         [Object, Object.keys, Array.prototype.push],
+                         'Builtin constructor, function and method')
 }
@@ -1,6 +1,35 @@
-exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer}) => {
+exports.runTests = async (assert, binding, {runInNewScope, gcUntil, addFinalizer, getAttachedTable}) => {
   const {View} = binding
 
+  const object = {}
+  const table = getAttachedTable(object)
+  assert.equal(getAttachedTable(object), table,
+               'AttachedTable is stored for object')
+  assert.deepStrictEqual(Reflect.ownKeys(object), [],
+                         'AttachedTable adds no properties')
+  assert.notEqual(getAttachedTable(Object.create(object)), table,
+                  'AttachedTable is not inherited from prototype')
+  const frozen = Object.freeze({})
+  assert.equal(getAttachedTable(frozen), getAttachedTable(frozen),
+               'AttachedTable of non-extensible object')
+  const view = new View
+  assert.equal(getAttachedTable(view), getAttachedTable(view),
+               'AttachedTable of wrapper')
+  assert.deepStrictEqual(Reflect.ownKeys(view), [],
+                         'AttachedTable adds no properties to wrapper')
+
+  await runInNewScope(async () => {
+    let viewCollected
+    runInNewScope(() => {
+      const view = new View
+      getAttachedTable(view).set('self', view)
+      addFinalizer(view, () => viewCollected = true)
+    })
+    await gcUntil(() => viewCollected)
+    assert.equal(viewCollected, true,
+                 'AttachedTable referencing its wrapper gets GCed')
+  })
+
   await runInNewScope(async () => {
     let parentCollected, childCollected
     runInNewScope(() => {